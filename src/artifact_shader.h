@@ -4,6 +4,13 @@
  * These shaders are WebGL 1.0 / GLSL ES 1.0 compatible for Emscripten builds.
  * They implement phase-based artifact coloring that matches authentic CoCo
  * composite video output.
+ *
+ * The work is split in two passes.  The resolve pass runs once per
+ * CoCo pixel (256x192): it turns each pixel's left/center/right
+ * neighborhood and X phase into a color through a lookup texture
+ * built by ShaderManager, and folds in phosphor persistence.  The
+ * present pass scales that to the window with one texture read per
+ * window pixel, adding scanlines if asked.
  */
 
 #ifndef DOD_ARTIFACT_SHADER_HEADER
@@ -20,75 +27,60 @@ static const char* ARTIFACT_VERTEX_SHADER =
     "    v_texcoord = a_texcoord;\n"
     "}\n";
 
-// Fragment Shader - NTSC artifact color emulation
-// Converts white pixels to cyan or orange based on X-coordinate phase
+// Resolve pass - NTSC artifact colors at native resolution
+// u_lut is 8x2: the column is the neighborhood (left*4 + center*2 +
+// right, each 1 if the pixel is lit), the row is the X phase.
 static const char* ARTIFACT_FRAGMENT_SHADER =
+    "#ifdef GL_ES\n"
     "precision mediump float;\n"
+    "#endif\n"
     "\n"
     "varying vec2 v_texcoord;\n"
     "uniform sampler2D u_texture;\n"
+    "uniform sampler2D u_lut;\n"
+    "uniform sampler2D u_previous;\n"
     "uniform vec2 u_resolution;\n"
-    "uniform int u_phaseFlip;\n"
-    "\n"
-    "// CoCo artifact colors (tuned to match MC1372 composite output)\n"
-    "const vec3 BLACK  = vec3(0.0, 0.0, 0.0);\n"
-    "const vec3 CYAN   = vec3(0.0, 0.85, 0.90);\n"
-    "const vec3 ORANGE = vec3(1.0, 0.45, 0.0);\n"
-    "const vec3 WHITE  = vec3(1.0, 1.0, 1.0);\n"
+    "uniform float u_phaseFlip;\n"
+    "uniform float u_persistence;\n"
     "\n"
-    "// Get luminance of pixel (determine if white or black)\n"
+    "// 1.0 if the pixel is lit (white), else 0.0\n"
     "float getLuma(vec2 coord) {\n"
     "    vec3 color = texture2D(u_texture, coord).rgb;\n"
     "    return step(0.5, dot(color, vec3(0.299, 0.587, 0.114)));\n"
     "}\n"
     "\n"
     "void main() {\n"
-    "    vec2 texelSize = 1.0 / u_resolution;\n"
-    "    vec2 pixelCoord = v_texcoord * u_resolution;\n"
-    "\n"
-    "    // Calculate X position as integer\n"
-    "    // GLSL ES 1.0 doesn't have integer modulo, use arithmetic\n"
-    "    float x = floor(pixelCoord.x);\n"
+    "    float texelX = 1.0 / u_resolution.x;\n"
+    "    float x = floor(v_texcoord.x * u_resolution.x);\n"
     "\n"
-    "    // Sample current pixel and horizontal neighbors\n"
+    "    float left   = getLuma(v_texcoord - vec2(texelX, 0.0));\n"
     "    float center = getLuma(v_texcoord);\n"
-    "    float left   = getLuma(v_texcoord - vec2(texelSize.x, 0.0));\n"
-    "    float right  = getLuma(v_texcoord + vec2(texelSize.x, 0.0));\n"
-    "\n"
-    "    // Determine phase (0 or 1) based on X coordinate\n"
-    "    float phase = x - floor(x / 2.0) * 2.0;\n"
-    "\n"
-    "    // Apply phase flip if enabled\n"
-    "    if (u_phaseFlip == 1) {\n"
-    "        phase = 1.0 - phase;\n"
-    "    }\n"
-    "\n"
-    "    vec3 outputColor = BLACK;\n"
+    "    float right  = getLuma(v_texcoord + vec2(texelX, 0.0));\n"
+    "    float index  = left * 4.0 + center * 2.0 + right;\n"
+    "    float phase  = abs(x - floor(x / 2.0) * 2.0 - u_phaseFlip);\n"
     "\n"
-    "    if (center > 0.5) {\n"
-    "        // This is a white pixel - determine artifact color\n"
+    "    vec3 color = texture2D(u_lut, vec2((index + 0.5) / 8.0,\n"
+    "                                       (phase + 0.5) / 2.0)).rgb;\n"
+    "    vec3 previous = texture2D(u_previous, v_texcoord).rgb;\n"
+    "    gl_FragColor = vec4(max(color, previous * u_persistence), 1.0);\n"
+    "}\n";
+
+// Present pass - scales the resolved image to the window
+static const char* PRESENT_FRAGMENT_SHADER =
+    "#ifdef GL_ES\n"
+    "precision mediump float;\n"
+    "#endif\n"
     "\n"
-    "        if (left > 0.5 && right > 0.5) {\n"
-    "            // Surrounded by white on both sides - stays white\n"
-    "            outputColor = WHITE;\n"
-    "        } else if (phase < 0.5) {\n"
-    "            // Even pixel phase - orange artifact\n"
-    "            outputColor = ORANGE;\n"
-    "            // Blend toward white if adjacent to another white pixel\n"
-    "            if (left > 0.5 || right > 0.5) {\n"
-    "                outputColor = mix(ORANGE, WHITE, 0.35);\n"
-    "            }\n"
-    "        } else {\n"
-    "            // Odd pixel phase - cyan artifact\n"
-    "            outputColor = CYAN;\n"
-    "            // Blend toward white if adjacent to another white pixel\n"
-    "            if (left > 0.5 || right > 0.5) {\n"
-    "                outputColor = mix(CYAN, WHITE, 0.35);\n"
-    "            }\n"
-    "        }\n"
-    "    }\n"
+    "varying vec2 v_texcoord;\n"
+    "uniform sampler2D u_texture;\n"
+    "uniform float u_rows;\n"
+    "uniform float u_scanline;\n"
     "\n"
-    "    gl_FragColor = vec4(outputColor, 1.0);\n"
+    "void main() {\n"
+    "    vec3 color = texture2D(u_texture, v_texcoord).rgb;\n"
+    "    // Darken the lower half of each CoCo row\n"
+    "    float lower = 1.0 - step(0.5, fract(v_texcoord.y * u_rows));\n"
+    "    gl_FragColor = vec4(color * (1.0 - u_scanline * lower), 1.0);\n"
     "}\n";
 
 #endif // DOD_ARTIFACT_SHADER_HEADER
@@ -0,0 +1,80 @@
+/****************************************
+Daggorath PC-Port Version 0.2.1
+Richard Hunerlach
+November 13, 2002
+
+The copyright for Dungeons of Daggorath
+is held by Douglas J. Morgan.
+(c) 1982, DynaMicro
+*****************************************/
+
+// Dungeons of Daggorath
+// PC-Port
+// Filename: context.h
+//
+// GameContext bundles every subsystem that makes up one
+// running game, and the familiar global names (game,
+// player, scheduler, ...) are references into it.
+//
+// In the headless build the context and the references are
+// DOD_CONTEXT_LOCAL (thread_local), so several independent
+// games can run in one process, one per thread.  The
+// interactive builds have one ordinary global context,
+// since SDL and OpenGL expect a single game on the main
+// thread.
+
+#ifndef DOD_CONTEXT_HEADER
+#define DOD_CONTEXT_HEADER
+
+#include "creature.h"
+#include "dod.h"
+#include "dodgame.h"
+#include "dungeon.h"
+#include "glyphbatch.h"
+#include "object.h"
+#include "oslink.h"
+#include "parser.h"
+#include "pixelbuf.h"
+#include "player.h"
+#include "sched.h"
+#include "shader.h"
+#include "vecstore.h"
+#include "viewcache.h"
+#include "viewer.h"
+
+class GameContext
+{
+public:
+	// The renderer's GL helpers.  Their constructors and
+	// destructors use none of the objects below.
+	ShaderManager	shaderMgr;
+	PixelBuffer	pixelBuf;
+	VectorStore	vecStore;
+	GlyphBatch	glyphBatch;
+	ViewCache	viewCache;
+	ViewCache	mapCache;
+
+	// Declaration order is construction order, and matches
+	// the order the globals were originally defined in.
+	dodGame		game;
+	Coordinate	crd;
+	RNG			rng;
+	Player		player;
+	Object		object;
+	Creature	creature;
+	Dungeon		dungeon;
+	Scheduler	scheduler;
+	Viewer		viewer;
+	OS_Link		oslink;
+	Parser		parser;
+};
+
+// The calling thread's game
+extern DOD_CONTEXT_LOCAL GameContext gameContext;
+
+// Constructs the calling thread's game.  In the headless
+// build a thread must call this before it touches any of
+// the global names; elsewhere it does nothing.
+void initGameContext();
+
+#endif // DOD_CONTEXT_HEADER
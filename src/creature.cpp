@@ -24,20 +24,49 @@ is held by Douglas J. Morgan.
 #include "oslink.h"
 #include "math.h"
 #include "enhanced.h"
-
-extern OS_Link		oslink;
-extern Player		player;
-extern RNG			rng;
-extern Viewer		viewer;
-extern dodGame		game;
-extern Dungeon		dungeon;
-extern Object		object;
-extern Scheduler	scheduler;
+#include <cstring>
+
+extern DOD_CONTEXT_LOCAL OS_Link		&oslink;
+extern DOD_CONTEXT_LOCAL Player		&player;
+extern DOD_CONTEXT_LOCAL RNG			&rng;
+extern DOD_CONTEXT_LOCAL Viewer		&viewer;
+extern DOD_CONTEXT_LOCAL dodGame		&game;
+extern DOD_CONTEXT_LOCAL Dungeon		&dungeon;
+extern DOD_CONTEXT_LOCAL Object		&object;
+extern DOD_CONTEXT_LOCAL Scheduler	&scheduler;
+
+// Creature counts for each level, five levels of twelve types;
+// CMXLND starts as a copy and is used up as creatures are made
+const dodBYTE Creature::CMXSTD[60] =
+{
+	9, 9, 4, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+	2, 4, 0, 6, 6, 6, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 4, 0, 6, 8, 4, 0, 0, 1, 0,
+	0, 0, 0, 0, 0, 0, 8, 6, 6, 4, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 4, 4, 8, 0, 1
+};
+
+// As CMXSTD, with a blob in place of a snake on level 1
+const dodBYTE Creature::CMXVIS[60] =
+{
+	9, 8, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+	2, 4, 0, 6, 6, 6, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 4, 0, 6, 8, 4, 0, 0, 1, 0,
+	0, 0, 0, 0, 0, 0, 8, 6, 6, 4, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 4, 4, 8, 0, 1
+};
+
+// Turns tried, in order, by a moving creature
+const dodBYTE Creature::MOVTAB[7] =
+{
+	0, 3, 1, 0, 1, 3, 0
+};
 
 // Constructor
 Creature::Creature()
 {
 	Reset();
+	Reindex();
 }
 
 void Creature::Reset()
@@ -63,10 +92,9 @@ void Creature::Reset()
 	CDBTAB[11] = CDB(8000,255,6,255,0,1300,700);
 	
 	if (game.VisionScroll)  //Do we need to replace a snake with a blob w/ a vision scroll?  Yes:
-		Utils::LoadFromDecDigit(CMXLND, "984300000000240666000000000406840010000000866400222222244801");
+		memcpy(CMXLND, CMXVIS, sizeof(CMXLND));
 	else  //Do we need to replace a snake with a blob w/ a vision scroll?  No:
-		Utils::LoadFromDecDigit(CMXLND, "994200000000240666000000000406840010000000866400222222244801");
-	Utils::LoadFromDecDigit(MOVTAB, "0310130");
+		memcpy(CMXLND, CMXSTD, sizeof(CMXLND));
 
 	for (int idx = 0; idx < CTYPES; ++idx)
 	{
@@ -119,6 +147,7 @@ void Creature::NEWLVL()
 	{
 		CCBLND[tmp].clear();
 	}
+	Reindex();
 	scheduler.SYSTCB();
 	dungeon.DGNGEN();
 	u = CMXPTR;
@@ -138,14 +167,9 @@ void Creature::NEWLVL()
 	} while (a != 0xFF);
 
 	u = -1;
-	object.OFINDF = 0;
-	do
+	for (idx = object.NextOnLevel(-1); idx != -1;
+		 idx = object.NextOnLevel(idx))
 	{
-		idx = object.FNDOBJ();
-		if (idx == -1)
-		{
-			break;
-		}
 		if (object.OCBLND[idx].P_OCOWN == 0xFF)
 		{
 			do
@@ -164,7 +188,7 @@ void Creature::NEWLVL()
 				}
 			} while (true);
 		}
-	} while (true);
+	}
 
 	// Determine video invert Setting
 	viewer.setVidInv((game.LEVEL % 2) ?true: false);
@@ -214,8 +238,7 @@ void Creature::CBIRTH(dodBYTE typ)
 	} while (CFIND(rw, cl) == false);
 	
 	//printf("----- %02X: %02X, %02X -----\n", typ, rw, cl);
-	CCBLND[u].P_CCROW = rw;
-	CCBLND[u].P_CCCOL = cl;
+	PlaceCreature(u, rw, cl);
 
 	TCBindex = scheduler.GETTCB();
 	scheduler.TCBLND[TCBindex].data = u;
@@ -223,30 +246,19 @@ void Creature::CBIRTH(dodBYTE typ)
 	scheduler.TCBLND[TCBindex].frequency = CCBLND[u].P_CCTMV;
 }
 
-// These two routines should probably be combined.
-// They check for a creature in the given cell
+// Checks for a creature in the given cell; true if it is empty
 bool Creature::CFIND(dodBYTE rw, dodBYTE cl)
 {
-	int ctr = 0;
-	while (ctr < 32)
-	{
-		if (CCBLND[ctr].P_CCROW == rw &&
-			CCBLND[ctr].P_CCCOL == cl)
-		{
-			if (CCBLND[ctr].P_CCUSE != 0)
-				return false;
-		}
-		++ctr;
-	}
-	return true;
+	return (CFIND2(RowCol(rw, cl)) == -1);
 }
 
-// These two routines should probably be combined.
-// They check for a creature in the given cell
+// Returns the lowest numbered creature in the given cell,
+// or -1.  A slot just claimed by CBIRTH still counts at its
+// old cell, as it did when every slot was scanned.
 int Creature::CFIND2(RowCol rc)
 {
-	int ctr = 0;
-	while (ctr < 32)
+	int ctr = cellHead[Dungeon::RC2IDX(rc.row, rc.col)];
+	while (ctr != -1)
 	{
 		if (CCBLND[ctr].P_CCROW == rc.row &&
 			CCBLND[ctr].P_CCCOL == rc.col)
@@ -256,11 +268,60 @@ int Creature::CFIND2(RowCol rc)
 				return ctr;
 			}
 		}
-		++ctr;
+		ctr = cellNext[ctr];
 	}
 	return -1;
 }
 
+// Moves a creature to the given cell
+void Creature::PlaceCreature(int cidx, dodBYTE rw, dodBYTE cl)
+{
+	UnlinkCell(cidx);
+	CCBLND[cidx].P_CCROW = rw;
+	CCBLND[cidx].P_CCCOL = cl;
+	LinkCell(cidx);
+}
+
+// Rebuilds the cell chains from CCBLND.  Needed whenever
+// CCBLND is changed other than through PlaceCreature.
+void Creature::Reindex()
+{
+	int ctr;
+	for (ctr = 0; ctr < 1024; ++ctr)
+	{
+		cellHead[ctr] = -1;
+	}
+	for (ctr = 31; ctr >= 0; --ctr)
+	{
+		cellNext[ctr] = -1;
+		LinkCell(ctr);
+	}
+}
+
+// Adds a slot to its cell's chain, keeping the chain in slot order
+void Creature::LinkCell(int cidx)
+{
+	int * link = &cellHead[Dungeon::RC2IDX(CCBLND[cidx].P_CCROW,
+										   CCBLND[cidx].P_CCCOL)];
+	while (*link != -1 && *link < cidx)
+	{
+		link = &cellNext[*link];
+	}
+	cellNext[cidx] = *link;
+	*link = cidx;
+}
+
+void Creature::UnlinkCell(int cidx)
+{
+	int * link = &cellHead[Dungeon::RC2IDX(CCBLND[cidx].P_CCROW,
+										   CCBLND[cidx].P_CCCOL)];
+	while (*link != cidx)
+	{
+		link = &cellNext[*link];
+	}
+	*link = cellNext[cidx];
+}
+
 // This method is called from the scheduler once every five
 // minutes.  It will generate random new creatures.
 int Creature::CREGEN()
@@ -321,9 +382,9 @@ int Creature::CMOVE(int task, int cidx)
 {
 	// Debug: Log when FRZFLG is non-zero (creatures are frozen)
 	// This helps diagnose the freeze bug where creatures stop moving entirely
-	static Uint32 lastFreezeLogTime = 0;
+	static DOD_CONTEXT_LOCAL Uint32 lastFreezeLogTime = 0;
 	if (FRZFLG != 0) {
-		Uint32 now = SDL_GetTicks();
+		Uint32 now = DOD_GetTicks();
 		// Only log once per second to avoid console spam
 		if (now - lastFreezeLogTime > 1000) {
 			printf("CMOVE DEBUG: FRZFLG=%d (non-zero = creatures frozen), task=%d, cidx=%d, level=%d\n",
@@ -344,7 +405,7 @@ int Creature::CMOVE(int task, int cidx)
 
 	int oidx, dir, X, loop;
 	bool doRandom = false;
-	dodBYTE r, c, rnd, d;
+	dodBYTE rnd, d;
 	dodBYTE shA, shB;
 	dodSHORT shD, shD2;
 
@@ -357,7 +418,7 @@ int Creature::CMOVE(int task, int cidx)
 				return false;
 			}
 		}
-		scheduler.curTime = SDL_GetTicks();
+		scheduler.curTime = DOD_GetTicks();
 		return true;
 	};
 	auto pumpNoAuto = [&]() -> bool {
@@ -365,7 +426,7 @@ int Creature::CMOVE(int task, int cidx)
 		{
 			scheduler.CLOCK();
 		}
-		scheduler.curTime = SDL_GetTicks();
+		scheduler.curTime = DOD_GetTicks();
 		return true;
 	};
 
@@ -388,9 +449,8 @@ int Creature::CMOVE(int task, int cidx)
 			)
 		   )
 		{
-			object.OFINDF = 0;
-			oidx = object.OFIND(RowCol(CCBLND[cidx].P_CCROW,
-									   CCBLND[cidx].P_CCCOL));
+			oidx = object.NextInCell(RowCol(CCBLND[cidx].P_CCROW,
+											CCBLND[cidx].P_CCCOL), -1);
 			if (oidx != -1)
 			{
 				object.OCBLND[oidx].P_OCPTR = CCBLND[cidx].P_CCOBJ;
@@ -501,19 +561,11 @@ int Creature::CMOVE(int task, int cidx)
 			{
 				dir = 3;
 			}
-			r = CCBLND[cidx].P_CCROW;
-			c = CCBLND[cidx].P_CCCOL;
-			do
+			if (!dungeon.InSight(CCBLND[cidx].P_CCROW, CCBLND[cidx].P_CCCOL,
+								 player.PROW, player.PCOL))
 			{
-				if (!dungeon.STEPOK(r, c, dir))
-				{
-					doRandom = true;
-					break;
-				}
-				r += dungeon.STPTAB[dir * 2];
-				c += dungeon.STPTAB[(dir * 2) + 1];	
-			} while (!(r == player.PROW &&
-					   c == player.PCOL));
+				doRandom = true;
+			}
 			if (doRandom == false)
 			{
 				CCBLND[cidx].P_CCDIR = dir;
@@ -547,19 +599,11 @@ int Creature::CMOVE(int task, int cidx)
 			{
 				dir = 0;
 			}
-			r = CCBLND[cidx].P_CCROW;
-			c = CCBLND[cidx].P_CCCOL;
-			do
+			if (!dungeon.InSight(CCBLND[cidx].P_CCROW, CCBLND[cidx].P_CCCOL,
+								 player.PROW, player.PCOL))
 			{
-				if (!dungeon.STEPOK(r, c, dir))
-				{
-					doRandom = true;
-					break;
-				}
-				r += dungeon.STPTAB[dir * 2];
-				c += dungeon.STPTAB[(dir * 2) + 1];	
-			} while (!(r == player.PROW &&
-					   c == player.PCOL));
+				doRandom = true;
+			}
 			if (doRandom == false)
 			{
 				CCBLND[cidx].P_CCDIR = dir;
@@ -653,7 +697,7 @@ bool Creature::CWALK(dodBYTE dir, CCB * cr)
 		{
 			scheduler.CLOCK();
 		}
-		scheduler.curTime = SDL_GetTicks();
+		scheduler.curTime = DOD_GetTicks();
 		return true;
 	};
 
@@ -706,16 +750,14 @@ bool Creature::CWALK(dodBYTE dir, CCB * cr)
 
 		if (big > 8)
 		{
-			cr->P_CCROW = rr;
-			cr->P_CCCOL = cc;
+			PlaceCreature(cr - CCBLND, rr, cc);
 			cr->P_CCDIR = DIR;
 			return true;
 		}
 
 		if (small > 2)
 		{
-			cr->P_CCROW = rr;
-			cr->P_CCCOL = cc;
+			PlaceCreature(cr - CCBLND, rr, cc);
 			cr->P_CCDIR = DIR;
 			return true;
 		}
@@ -789,8 +831,7 @@ bool Creature::CWALK(dodBYTE dir, CCB * cr)
 			scheduler.WaitForChannel(creChannelv, walkerPump);
 		}
 
-		cr->P_CCROW = rr;
-		cr->P_CCCOL = cc;
+		PlaceCreature(cr - CCBLND, rr, cc);
 		cr->P_CCDIR = DIR;
 
 		--viewer.NEWLUK;
@@ -32,6 +32,8 @@ public:
 	bool		CWALK(dodBYTE dir, CCB * cr);
 	bool		CFIND(dodBYTE rw, dodBYTE cl);
 	int			CFIND2(RowCol rc);
+	void		PlaceCreature(int cidx, dodBYTE rw, dodBYTE cl);
+	void		Reindex();
 	void		Reset();
 	void		LoadSounds();
 	void		UpdateCreSpeed();
@@ -41,7 +43,9 @@ public:
 	dodBYTE		FRZFLG;
 	int			CMXPTR;
 	dodBYTE		CMXLND[60];
-	dodBYTE		MOVTAB[7];
+	static const dodBYTE CMXSTD[60];
+	static const dodBYTE CMXVIS[60];
+	static const dodBYTE MOVTAB[7];
 	Mix_Chunk * creSound[12];
 	Mix_Chunk * clank;
 	Mix_Chunk * kaboom;
@@ -68,10 +72,17 @@ public:
 private:
 	// Internal Implementation
 	void CBIRTH(dodBYTE a);
+	void LinkCell(int cidx);
+	void UnlinkCell(int cidx);
 
 	// Data Fields
 	CDB			CDBTAB[12];
 	CDB			baseCDB[12];
+
+	// Every CCBLND slot, in use or not, chained by the cell it is in,
+	// lowest slot first.  See Reindex().
+	int			cellHead[1024];
+	int			cellNext[32];
 	
 	// Constants
 	enum {
@@ -34,20 +34,45 @@ is held by Douglas J. Morgan.
 #include "oslink.h"
 #include "parser.h"
 #include "enhanced.h"
+#include "context.h"
 #include <cstring>
 #include <cstdlib>
 
-dodGame		game;
-Coordinate	crd;
-RNG			rng;
-Player		player;
-Object		object;
-Creature	creature;
-Dungeon		dungeon;
-Scheduler	scheduler;
-Viewer		viewer;
-OS_Link		oslink;
-Parser		parser;
+// The primary objects live in a GameContext (see
+// context.h); these names refer to the current game's
+// copy.  In the headless build each thread has its own,
+// and the references are bound before the context is
+// constructed because the constructors already reach
+// each other through them.
+DOD_CONTEXT_LOCAL dodGame	&game = gameContext.game;
+DOD_CONTEXT_LOCAL Coordinate	&crd = gameContext.crd;
+DOD_CONTEXT_LOCAL RNG		&rng = gameContext.rng;
+DOD_CONTEXT_LOCAL Player		&player = gameContext.player;
+DOD_CONTEXT_LOCAL Object		&object = gameContext.object;
+DOD_CONTEXT_LOCAL Creature	&creature = gameContext.creature;
+DOD_CONTEXT_LOCAL Dungeon	&dungeon = gameContext.dungeon;
+DOD_CONTEXT_LOCAL Scheduler	&scheduler = gameContext.scheduler;
+DOD_CONTEXT_LOCAL Viewer		&viewer = gameContext.viewer;
+DOD_CONTEXT_LOCAL OS_Link	&oslink = gameContext.oslink;
+DOD_CONTEXT_LOCAL Parser		&parser = gameContext.parser;
+DOD_CONTEXT_LOCAL ShaderManager	&shaderMgr = gameContext.shaderMgr;
+DOD_CONTEXT_LOCAL PixelBuffer	&pixelBuf = gameContext.pixelBuf;
+DOD_CONTEXT_LOCAL VectorStore	&vecStore = gameContext.vecStore;
+DOD_CONTEXT_LOCAL GlyphBatch	&glyphBatch = gameContext.glyphBatch;
+DOD_CONTEXT_LOCAL ViewCache	&viewCache = gameContext.viewCache;
+DOD_CONTEXT_LOCAL ViewCache	&mapCache = gameContext.mapCache;
+
+DOD_CONTEXT_LOCAL GameContext	gameContext;
+
+void initGameContext()
+{
+	// Referring to the context from this file is enough to
+	// run the thread's initialisation of everything above.
+	// Other files assume it has already happened (see
+	// -fno-extern-tls-init in the Makefile), so every
+	// thread_local with a constructor must be in the context.
+	(void) &gameContext;
+}
 
 // Could include some command line arguments for
 // various purposes (like configurations) if desired later.
@@ -58,6 +83,7 @@ Parser		parser;
 void printvls();
 void printthem(int *, int, char *);
 
+#ifndef DOD_HEADLESS
 int main(int argc, char * argv[])
 {
 	//printvls();
@@ -67,6 +93,7 @@ int main(int argc, char * argv[])
     oslink.init();
 	return 0;
 }
+#endif
 
 extern "C" {
     void sendinput(char * input) {
@@ -176,6 +203,14 @@ extern "C" {
         free(configCopy);
     }
 
+    // Scheduler profile as text, for the browser console.
+    // Enable collection first with SETOPT PROFILE ON.
+    const char * getprofile() {
+        static std::string text;
+        text = scheduler.profiler.report();
+        return text.c_str();
+    }
+
     void sendkey(int keycode) {
         oslink.send_key(keycode);
     }
@@ -190,7 +225,7 @@ extern "C" {
 
 }
 
-void printalpha(int * vl, int len, std::string name)
+void printalpha(const dodBYTE * vl, int len, std::string name)
 {
 	int ctr;
 	printf("Utils::LoadFromDecDigit(%s, \"", name.c_str());
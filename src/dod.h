@@ -38,6 +38,10 @@ is held by Douglas J. Morgan.
 
 #include <iostream>
 
+#ifdef DOD_HEADLESS
+// Null platform layer for the headless simulation build
+#include "headless.h"
+#else
 // SDL Headers
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_opengl.h>
@@ -45,6 +49,38 @@ is held by Douglas J. Morgan.
 //#include <GLES2/gl2.h>
 //#include <GLES2/gl2ext.h>
 #include <SDL2/SDL_mixer.h>
+#endif
+
+// Builds driven one frame at a time that must never block inside
+// game logic: Emscripten without ASYNCIFY, and the headless
+// simulator.  These run fades, animations and menus through the
+// dodGame state machine instead of the desktop blocking loops.
+#if (defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_ASYNCIFY__)) || \
+    defined(DOD_HEADLESS)
+#define DOD_NONBLOCKING
+#endif
+
+// Storage class for per-game state (see context.h).  Only the
+// headless simulator runs several games at once, one per thread;
+// the interactive builds keep ordinary globals.
+#ifdef DOD_HEADLESS
+#define DOD_CONTEXT_LOCAL thread_local
+#else
+#define DOD_CONTEXT_LOCAL
+#endif
+
+// Game time source.  All game logic reads the clock through
+// DOD_GetTicks; the headless build substitutes a virtual clock
+// that only moves when the driver (or DOD_Delay) advances it.
+#ifdef DOD_HEADLESS
+inline Uint32 DOD_GetTicks() {
+  return dodVirtualTicks;
+}
+#else
+inline Uint32 DOD_GetTicks() {
+  return SDL_GetTicks();
+}
+#endif
 
 // Non-blocking delay for Emscripten without ASYNCIFY
 // SDL_Delay would block the browser, so we make it a no-op
@@ -53,6 +89,10 @@ is held by Douglas J. Morgan.
 inline void DOD_Delay(Uint32 ms) {
   (void)ms; // No-op: cannot block without ASYNCIFY
 }
+#elif defined(DOD_HEADLESS)
+inline void DOD_Delay(Uint32 ms) {
+  dodVirtualTicks += ms; // Simulated time passes instantly
+}
 #else
 inline void DOD_Delay(Uint32 ms) {
   SDL_Delay(ms);
@@ -72,6 +112,7 @@ inline void DOD_Delay(Uint32 ms) {
 // (i.e., native C types) will work correctly.
 typedef unsigned char	dodBYTE;
 typedef unsigned short	dodSHORT;
+typedef unsigned int	dodLONG;	// 32 bits, one maze row of flags
 
 // This class is used to translate between original 256x192
 // coordinates and whichever modern coordinate system is used.
@@ -406,6 +447,13 @@ public:
 };
 
 // This class is a port of Daggorath's custom Random Number Generator
+//
+// The seeds form a 24-bit shift register, SEED[2] high, that the
+// original shifts left one bit at a time, feeding back the parity of
+// SEED[2] & 0xE1.  Eight such steps only ever read bits 9-23, and
+// the feedback is linear, so RANDOM() does all eight at once with two
+// tables (see rng.cpp).  The sequence, and carry, match the original
+// bit for bit.
 class RNG
 {
 public:
@@ -421,27 +469,17 @@ public:
 	// Accessors
 	dodBYTE RANDOM()
 	{
-		int x, y;
-		dodBYTE a, b;
-		carry = 0;
-		for (x = 8; x != 0; --x)
-		{
-			b = 0;
-			a = (SEED[2] & 0xE1);
-			for (y = 8; y != 0; --y)
-			{
-				a = lsl(a);
-				if (carry != 0)
-					++b;
-			}
-			b = lsr(b);
-			SEED[0] = rol(SEED[0]);
-			SEED[1] = rol(SEED[1]);
-			SEED[2] = rol(SEED[2]);
-		}
+		dodBYTE a = FBHI[SEED[2]] ^ FBLO[SEED[1]];
+		carry = SEED[2] & 1;	// last bit rotated out of SEED[2]
+		SEED[2] = SEED[1];
+		SEED[1] = SEED[0];
+		SEED[0] = a;
 		return SEED[0];
 	}
 
+	// Same as calling RANDOM() n times, in O(log n)
+	void skip(unsigned long n);
+
 	dodBYTE getSEED(int idx)
 	{
 		return SEED[idx];
@@ -464,28 +502,9 @@ public:
 	dodBYTE carry;
 
 private:
-	// Internal Implementation
-	dodBYTE lsl(dodBYTE c)
-	{
-		carry = (((c & 128) == 128) ? 1 : 0);
-		return c << 1;
-	}
-
-	dodBYTE lsr(dodBYTE c)
-	{
-		carry = (((c & 1) == 1) ? 1 : 0);
-		return c >> 1;
-	}
-
-	dodBYTE rol(dodBYTE c)
-	{
-		dodBYTE cry;
-		cry = (((c & 128) == 128) ? 1 : 0);
-		c <<= 1;
-		c += carry;
-		carry = cry;
-		return c;
-	}
+	// Feedback byte contributed by SEED[2] and SEED[1]
+	static const dodBYTE FBHI[256];
+	static const dodBYTE FBLO[256];
 };
 
 // Not much here at the moment, but it could grow
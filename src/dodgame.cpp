@@ -24,16 +24,17 @@ is held by Douglas J. Morgan.
 #include "player.h"
 #include "sched.h"
 #include "viewer.h"
-
-extern OS_Link oslink;
-extern Dungeon dungeon;
-extern Parser parser;
-extern Creature creature;
-extern Object object;
-extern Player player;
-extern Viewer viewer;
-extern Scheduler scheduler;
-extern RNG rng;
+#include <cmath>
+
+extern DOD_CONTEXT_LOCAL OS_Link &oslink;
+extern DOD_CONTEXT_LOCAL Dungeon &dungeon;
+extern DOD_CONTEXT_LOCAL Parser &parser;
+extern DOD_CONTEXT_LOCAL Creature &creature;
+extern DOD_CONTEXT_LOCAL Object &object;
+extern DOD_CONTEXT_LOCAL Player &player;
+extern DOD_CONTEXT_LOCAL Viewer &viewer;
+extern DOD_CONTEXT_LOCAL Scheduler &scheduler;
+extern DOD_CONTEXT_LOCAL RNG &rng;
 
 #define D_EXAMINE "010f"
 #define D_PULL_RIGHT "032605"
@@ -97,8 +98,8 @@ void dodGame::initFadeState(int mode) {
   fadeVCTFAD = 32;
   fadeInterrupted = false;
   postFadeAction = POST_FADE_NONE; // Clear any previous post-fade action
-  nextFrameTime = SDL_GetTicks();
-  stateStartTime = SDL_GetTicks();
+  nextFrameTime = DOD_GetTicks();
+  stateStartTime = DOD_GetTicks();
 
   // Set up viewer state
   viewer.VXSCAL = 0x80;
@@ -150,7 +151,8 @@ void dodGame::initFadeState(int mode) {
 
 // Draw one frame of the fade animation
 void dodGame::drawFadeFrame() {
-  int *wiz = (fadeMode == Viewer::FADE_VICTORY) ? viewer.W2_VLA : viewer.W1_VLA;
+  const dodBYTE *wiz =
+      (fadeMode == Viewer::FADE_VICTORY) ? viewer.W2_VLA : viewer.W1_VLA;
 
   viewer.beginFrame();
   glClear(GL_COLOR_BUFFER_BIT);
@@ -171,7 +173,7 @@ void dodGame::drawFadeFrame() {
 
 // Process one frame of fade animation, returns true when complete
 bool dodGame::processFadeFrame() {
-  Uint32 now = SDL_GetTicks();
+  Uint32 now = DOD_GetTicks();
 
   // Draw every frame (~60fps) for smooth visuals
   bool shouldDraw = (now >= nextFrameTime);
@@ -399,7 +401,7 @@ void dodGame::requestMenu() {
 
 // State machine update - called each frame, returns true when scheduler should run
 bool dodGame::updateState() {
-  Uint32 now = SDL_GetTicks();
+  Uint32 now = DOD_GetTicks();
 
   switch (gameState) {
   case STATE_INIT:
@@ -488,6 +490,49 @@ bool dodGame::updateState() {
   }
 }
 
+// Returns the SDL tick of the next timer the state machine
+// is waiting on, so the desktop loop can sleep until then.
+// Input events wake the loop early regardless.
+Uint32 dodGame::nextWakeTime() {
+  Uint32 now = DOD_GetTicks();
+  Uint32 animWake;
+
+  switch (gameState) {
+  case STATE_PREPARE_WAIT:
+  case STATE_DEMO_MAP_WAIT:
+  case STATE_RESTART_WAIT:
+    return stateStartTime + stateWaitTime;
+
+  case STATE_PLAYING:
+    return scheduler.nextWakeTime();
+
+  case STATE_TURN_ANIMATION:
+  case STATE_MOVE_ANIMATION:
+  case STATE_FAINT_ANIMATION:
+  case STATE_RECOVER_ANIMATION:
+    // Frame timer, or the heartbeat clock that runs alongside it
+    animWake = animFrameStart + animFrameDuration;
+    if (scheduler.TCBLND[0].next_time < animWake) {
+      animWake = scheduler.TCBLND[0].next_time;
+    }
+    return animWake;
+
+  case STATE_FADE_INTRO:
+  case STATE_DEATH_FADE:
+  case STATE_WIN_FADE:
+  case STATE_INTERMISSION_FADE:
+  case STATE_MENU:
+  case STATE_MENU_LIST:
+  case STATE_MENU_SCROLLBAR:
+  case STATE_MENU_STRING:
+    // Redrawn at a fixed ~60fps cadence
+    return nextFrameTime;
+
+  default:
+    return now;
+  }
+}
+
 bool dodGame::updateFadeIntro() {
   // Don't call process_events() here - let keyCheck() in processFadeFrame handle events
   // so that key presses can skip the intro fade
@@ -500,7 +545,7 @@ bool dodGame::updateFadeIntro() {
     viewer.draw_game();
 
     gameState = STATE_PREPARE_WAIT;
-    stateStartTime = SDL_GetTicks();
+    stateStartTime = DOD_GetTicks();
     stateWaitTime = viewer.prepPause;
   }
   return false;
@@ -566,7 +611,7 @@ bool dodGame::updateIntermissionFade() {
 }
 
 bool dodGame::updateMenu() {
-  Uint32 now = SDL_GetTicks();
+  Uint32 now = DOD_GetTicks();
   if (now < nextFrameTime) {
     return false;
   }
@@ -868,7 +913,7 @@ bool dodGame::updateMenu() {
 }
 
 bool dodGame::updateMenuList() {
-  Uint32 now = SDL_GetTicks();
+  Uint32 now = DOD_GetTicks();
   if (now < nextFrameTime) {
     return false;
   }
@@ -916,7 +961,7 @@ bool dodGame::updateMenuList() {
 }
 
 bool dodGame::updateMenuScrollbar() {
-  Uint32 now = SDL_GetTicks();
+  Uint32 now = DOD_GetTicks();
   if (now < nextFrameTime) {
     return false;
   }
@@ -972,7 +1017,7 @@ bool dodGame::updateMenuScrollbar() {
 }
 
 bool dodGame::updateMenuString() {
-  Uint32 now = SDL_GetTicks();
+  Uint32 now = DOD_GetTicks();
   if (now < nextFrameTime) {
     return false;
   }
@@ -1060,12 +1105,16 @@ void dodGame::Restart() {
 
   // Non-blocking: set state to wait
   gameState = STATE_RESTART_WAIT;
-  stateStartTime = SDL_GetTicks();
+  stateStartTime = DOD_GetTicks();
   stateWaitTime = 2500;
 }
 
 void dodGame::LoadGame() {
   scheduler.LOAD();
+  showLoadedGame();
+}
+
+void dodGame::showLoadedGame() {
   viewer.setVidInv((game.LEVEL % 2) ? true : false);
   --viewer.UPDATE;
   viewer.draw_game();
@@ -1141,7 +1190,7 @@ void dodGame::requestTurnAnimation(dodBYTE direction) {
   viewer.SETFAD();
   player.turning = true;
 
-  animFrameStart = SDL_GetTicks();
+  animFrameStart = DOD_GetTicks();
   animFrameDuration = player.turnDelay;
   returnState = STATE_PLAYING;
   gameState = STATE_TURN_ANIMATION;
@@ -1166,7 +1215,7 @@ void dodGame::requestMoveAnimation(dodBYTE direction) {
   }
 
   viewer.PUPDAT();
-  animFrameStart = SDL_GetTicks();
+  animFrameStart = DOD_GetTicks();
   animFrameDuration = player.moveDelay / 2;
   returnState = STATE_PLAYING;
   gameState = STATE_MOVE_ANIMATION;
@@ -1175,7 +1224,7 @@ void dodGame::requestMoveAnimation(dodBYTE direction) {
 // Update turn animation, returns true when complete
 bool dodGame::updateTurnAnimation() {
   oslink.process_events();
-  Uint32 now = SDL_GetTicks();
+  Uint32 now = DOD_GetTicks();
 
   // Run scheduler clock during animation
   scheduler.curTime = now;
@@ -1240,7 +1289,7 @@ bool dodGame::updateTurnAnimation() {
 // Update move animation, returns true when complete
 bool dodGame::updateMoveAnimation() {
   oslink.process_events();
-  Uint32 now = SDL_GetTicks();
+  Uint32 now = DOD_GetTicks();
 
   // Run scheduler clock during animation
   scheduler.curTime = now;
@@ -1312,7 +1361,7 @@ void dodGame::requestFaintAnimation() {
   viewer.draw_game();
   --viewer.RLIGHT;
   ++faintStepCount;
-  animFrameStart = SDL_GetTicks(); // Start timer for next step
+  animFrameStart = DOD_GetTicks(); // Start timer for next step
 
   // Check if animation completed on first step (RLIGHT was already close to 248)
   // This shouldn't happen in normal gameplay but handle it gracefully
@@ -1350,13 +1399,13 @@ void dodGame::requestRecoverAnimation() {
   ++viewer.MLIGHT;
   ++viewer.RLIGHT;
   ++faintStepCount;
-  animFrameStart = SDL_GetTicks(); // Start timer for next step
+  animFrameStart = DOD_GetTicks(); // Start timer for next step
 }
 
 // Update faint animation (screen dims while heartbeat races)
 bool dodGame::updateFaintAnimation() {
   oslink.process_events();
-  Uint32 now = SDL_GetTicks();
+  Uint32 now = DOD_GetTicks();
 
   // Run scheduler clock during animation (this drives the heartbeat!)
   scheduler.curTime = now;
@@ -1417,7 +1466,7 @@ bool dodGame::updateFaintAnimation() {
 // Update recover animation (screen brightens as player recovers)
 bool dodGame::updateRecoverAnimation() {
   oslink.process_events();
-  Uint32 now = SDL_GetTicks();
+  Uint32 now = DOD_GetTicks();
 
   // Run scheduler clock during animation (keeps heartbeat going)
   scheduler.curTime = now;
@@ -91,11 +91,13 @@ public:
 	void INIVU();	// View initialization
 	void Restart();
 	void LoadGame();
+	void showLoadedGame();	// redraws after the game state is replaced
 	void WAIT();
 	void resetDemoState();  // Reset demo state machine for new demo
 
 	// State machine interface (non-blocking)
 	bool updateState();  // Called each frame, returns true when scheduler should run
+	Uint32 nextWakeTime(); // Earliest tick at which updateState() has work to do
 	GameState getState() const { return gameState; }
 	void setState(GameState state) { gameState = state; }
 
@@ -19,9 +19,9 @@ is held by Douglas J. Morgan.
 #include "player.h"
 #include "sched.h"
 
-extern Scheduler	scheduler;
-extern Player		player;
-extern dodGame		game;
+extern DOD_CONTEXT_LOCAL Scheduler	&scheduler;
+extern DOD_CONTEXT_LOCAL Player		&player;
+extern DOD_CONTEXT_LOCAL dodGame		&game;
 
 // Scaffolding Code
 
@@ -88,21 +88,6 @@ Dungeon::Dungeon() : VFTPTR(0)
 	SetLEVTABOrig();  //Original seed values will be overwritten (in Player::setInitialObjects())
 					 //if new random map game.
 
-	MSKTAB[0] = 0x03;
-	MSKTAB[1] = 0x0C;
-	MSKTAB[2] = 0x30;
-	MSKTAB[3] = 0xC0;
-
-	DORTAB[0] = HF_DOR;
-	DORTAB[1] = (HF_DOR << 2);
-	DORTAB[2] = (HF_DOR << 4);
-	DORTAB[3] = (HF_DOR << 6);
-
-	SDRTAB[0] = HF_SDR;
-	SDRTAB[1] = (HF_SDR << 2);
-	SDRTAB[2] = (HF_SDR << 4);
-	SDRTAB[3] = (HF_SDR << 6);
-
 	STPTAB[0] = -1;
 	STPTAB[1] = 0;
 	STPTAB[2] = 0;
@@ -132,8 +117,8 @@ void Dungeon::DGNGEN()
 {
 	/* Locals */
 	int		mzctr;
-	int		maz_idx;
 	int		cell_ctr;
+	dodLONG	above;
 	dodBYTE	a_row;
 	dodBYTE	a_col;
 	dodBYTE	b_row;
@@ -146,10 +131,10 @@ void Dungeon::DGNGEN()
 
 	/* Phase 1: Create Maze */
 
-	/* Set Cells to 0xFF */
-	for (mzctr=0; mzctr<1024; ++mzctr)
+	/* Set Cells to solid rock */
+	for (mzctr=0; mzctr<32; ++mzctr)
 	{
-		MAZLND[mzctr] = 0xFF;
+		openCells[mzctr] = 0;
 	}
 
 	rng.setSEED(LEVTAB[game.LEVEL], LEVTAB[game.LEVEL+1], LEVTAB[game.LEVEL+2]);  //Initialize Random Number Generator
@@ -202,8 +187,7 @@ void Dungeon::DGNGEN()
 		//Also need to make sure ladder back up to each level is in a tunneled out room.
 		DROW.setRC(a_row, a_col);
 		RndDstDir(&DIR, &DST);
-		maz_idx = RC2IDX(a_row, a_col);
-		MAZLND[maz_idx] = 0;
+		openCells[a_row & 31] |= (1u << (a_col & 31));
 		--cell_ctr;
 	}  //Is this an original game?
 
@@ -223,23 +207,18 @@ void Dungeon::DGNGEN()
 			continue;
 		}
 
-		/* Store index and temp room */
-		maz_idx = RC2IDX(b_row, b_col);
+		/* Store temp room */
 		ROW.setRC(b_row, b_col);
 
 		/* If not yet touched */
-		if (MAZLND[maz_idx] == 0xFF)
+		if (!IsOpen(b_row, b_col))
 		{
-			FRIEND(ROW);
-			if (NEIBOR[3] + NEIBOR[0] + NEIBOR[1] == 0 ||
-				NEIBOR[1] + NEIBOR[2] + NEIBOR[5] == 0 ||
-				NEIBOR[5] + NEIBOR[8] + NEIBOR[7] == 0 ||
-				NEIBOR[7] + NEIBOR[6] + NEIBOR[3] == 0)
+			if (MakesBlock(b_row, b_col))
 			{
 				RndDstDir(&DIR, &DST);
 				continue;
 			}
-			MAZLND[maz_idx] = 0;
+			openCells[b_row] |= (1u << b_col);
 			--cell_ctr;
 		}
 		if (cell_ctr > 0)
@@ -260,36 +239,28 @@ void Dungeon::DGNGEN()
 
 	/* Phase 2: Create Walls */
 
-	for (DROW.row = 0; DROW.row < 32; ++DROW.row)
+	// A side is a wall unless the cells on both sides are open
+	for (mzctr = 0; mzctr < 32; ++mzctr)
 	{
-		for (DROW.col = 0; DROW.col < 32; ++DROW.col)
-		{
-			maz_idx = RC2IDX(DROW.row, DROW.col);
-			if (MAZLND[maz_idx] != 0xFF)
-			{
-				FRIEND(DROW);
-				if (NEIBOR[1] == 0xFF)
-					MAZLND[maz_idx] |= N_WALL;
-				if (NEIBOR[3] == 0xFF)
-					MAZLND[maz_idx] |= W_WALL;
-				if (NEIBOR[5] == 0xFF)
-					MAZLND[maz_idx] |= E_WALL;
-				if (NEIBOR[7] == 0xFF)
-					MAZLND[maz_idx] |= S_WALL;
-			}
-		}
+		above = (mzctr > 0) ? openCells[mzctr - 1] : 0;
+		hEdge[HF_WAL - 1][mzctr] = ~(openCells[mzctr] & above);
+		vEdge[HF_WAL - 1][mzctr] = ~(openCells[mzctr] & (openCells[mzctr] << 1));
+		hEdge[HF_DOR - 1][mzctr] = 0;
+		vEdge[HF_DOR - 1][mzctr] = 0;
+		hEdge[HF_SDR - 1][mzctr] = 0;
+		vEdge[HF_SDR - 1][mzctr] = 0;
 	}
 
 	/* Phase 3: Create Doors/Secret Doors */
 
 	for (mzctr = 0; mzctr < 70; ++mzctr)
 	{
-		MAKDOR(this->DORTAB);
+		MAKDOR(HF_DOR);
 	}
 
 	for (mzctr = 0; mzctr < 45; ++mzctr)
 	{
-		MAKDOR(this->SDRTAB);
+		MAKDOR(HF_SDR);
 	}
 
 	/* Phase 4: Create vertical feature */
@@ -302,8 +273,7 @@ void Dungeon::DGNGEN()
 				a_col = (rng.RANDOM() & 31);
 				a_row = (rng.RANDOM() & 31);
 				ROW.setRC(a_row, a_col);
-				maz_idx = RC2IDX(a_row, a_col);
-			} while (MAZLND[maz_idx] == 0xFF);
+			} while (!IsOpen(a_row, a_col));
 		} while ((game.LEVEL == 0 && VFTTAB[1] == a_row && VFTTAB[2] == a_col) ||
 				 (game.LEVEL == 1 && VFTTAB[5] == a_row && VFTTAB[6] == a_col));
 		switch (game.LEVEL)
@@ -329,7 +299,8 @@ void Dungeon::DGNGEN()
 		}
 	}
 
-
+	UnpackMaze();
+	IndexRuns();
 
 	// Spin the RNG
 	if (scheduler.curTime == 0)
@@ -348,10 +319,9 @@ void Dungeon::DGNGEN()
 		spin = (scheduler.curTime % 60);
 	}
 
-	while (spin > 0)
+	if (spin > 0)
 	{
-		rng.RANDOM();
-		--spin;
+		rng.skip(spin);
 	}
 }
 
@@ -416,15 +386,13 @@ bool Dungeon::TryMove(dodBYTE dir)
 		return false;
 }
 
-// Adds doors
-void Dungeon::MAKDOR(dodBYTE * table)
+// Adds a door or secret door (code) to an open side
+void Dungeon::MAKDOR(dodBYTE code)
 {
 	dodBYTE	a_row;
 	dodBYTE	a_col;
-	int		maz_idx;
-	dodBYTE	val;
 	dodBYTE	DIR;
-	RowCol	ROW;
+	Plane *	edge;
 
 	do
 	{
@@ -432,45 +400,199 @@ void Dungeon::MAKDOR(dodBYTE * table)
 		{
 			a_col = (rng.RANDOM() & 31);
 			a_row = (rng.RANDOM() & 31);
-			ROW.setRC(a_row, a_col);
-			maz_idx = RC2IDX(a_row, a_col);
-			val = MAZLND[maz_idx];
-		} while (val == 0xFF);
+		} while (!IsOpen(a_row, a_col));
 
 		DIR = (rng.RANDOM() & 3);
-	} while ((val & MSKTAB[DIR]) != 0);
+	} while (SideCode(a_row, a_col, DIR) != HF_PAS);
+
+	edge = SideEdge(a_row, a_col, DIR);
+	edge[code - 1][a_row] |= (1u << a_col);
+}
+
+// Checks if opening a cell would finish a 2x2 block
+// of open cells, which the maze never has
+bool Dungeon::MakesBlock(dodBYTE R, dodBYTE C)
+{
+	dodLONG above = (R > 0) ? openCells[R - 1] : 0;
+	dodLONG below = (R < 31) ? openCells[R + 1] : 0;
 
-	MAZLND[maz_idx] |= table[DIR];
+	// Columns C-1, C and C+1 as bits 0, 1 and 2
+	int n = (int)((((unsigned long long)above << 1) >> C) & 7);
+	int m = (int)((((unsigned long long)openCells[R] << 1) >> C) & 7);
+	int s = (int)((((unsigned long long)below << 1) >> C) & 7);
+
+	if ((m & 1) != 0 && ((n & 3) == 3 || (s & 3) == 3)) return true;
+	if ((m & 4) != 0 && ((n & 6) == 6 || (s & 6) == 6)) return true;
+	return false;
+}
 
-	ROW.row += STPTAB[DIR * 2];
-	ROW.col += STPTAB[(DIR * 2) + 1];
-	DIR += 2;
-	DIR &= 3;
-	maz_idx = RC2IDX(ROW.row, ROW.col);
-	MAZLND[maz_idx] |= table[DIR];
+// Finds the edge plane row and bit holding the given side
+// of a cell.  Moves R/C to the neighbor for south and east
+// sides, and returns NULL for the outer edge of the maze.
+Dungeon::Plane * Dungeon::SideEdge(dodBYTE & R, dodBYTE & C, dodBYTE dir)
+{
+	switch (dir & 3)
+	{
+	case 0:
+		return hEdge;
+	case 1:
+		if (C == 31) return NULL;
+		++C;
+		return vEdge;
+	case 2:
+		if (R == 31) return NULL;
+		++R;
+		return hEdge;
+	default:
+		return vEdge;
+	}
 }
 
-// Finds surrounding cells
-void Dungeon::FRIEND(RowCol RC)
+// Returns the HF_ code of a side of a cell
+dodBYTE Dungeon::SideCode(dodBYTE R, dodBYTE C, dodBYTE dir)
 {
-	dodBYTE r3, c3;
-	int u = 0;
+	Plane * edge = SideEdge(R, C, dir);
+	dodBYTE code;
 
-	for (r3 = RC.row; r3 <= (RC.row+2); ++r3)
+	if (edge == NULL) return HF_WAL;
+	for (code = HF_WAL; code != HF_PAS; --code)
 	{
-		for (c3 = RC.col; c3 <= (RC.col+2); ++c3)
+		if (((edge[code - 1][R] >> C) & 1) != 0) return code;
+	}
+	return HF_PAS;
+}
+
+// Rebuilds MAZLND from the bit planes
+void Dungeon::UnpackMaze()
+{
+	dodBYTE R, C, dir;
+	dodBYTE val;
+
+	for (R = 0; R < 32; ++R)
+	{
+		for (C = 0; C < 32; ++C)
 		{
-			if (BORDER((r3-1), (c3-1)) == false)
+			val = 0;
+			for (dir = 0; dir < 4; ++dir)
 			{
-				NEIBOR[u] = 0xFF;
+				val |= (SideCode(R, C, dir) << (dir * 2));
 			}
-			else
+			MAZLND[RC2IDX(R, C)] = val;
+		}
+	}
+}
+
+// Rebuilds the bit planes from MAZLND, as after loading a game.
+// Each cell gives its north and west sides.
+void Dungeon::PackMaze()
+{
+	int R, C, code;
+	dodBYTE val;
+
+	for (R = 0; R < 32; ++R)
+	{
+		openCells[R] = 0;
+		for (code = 0; code < 3; ++code)
+		{
+			hEdge[code][R] = 0;
+			vEdge[code][R] = 0;
+		}
+		for (C = 0; C < 32; ++C)
+		{
+			val = MAZLND[RC2IDX(R, C)];
+			if (val != 0xFF)
+			{
+				openCells[R] |= (1u << C);
+			}
+			code = (val & N_WALL);
+			if (code != HF_PAS)
+			{
+				hEdge[code - 1][R] |= (1u << C);
+			}
+			code = (val & W_WALL) >> 6;
+			if (code != HF_PAS)
 			{
-				NEIBOR[u] = MAZLND[RC2IDX((r3-1), (c3-1))];
+				vEdge[code - 1][R] |= (1u << C);
 			}
-			++u;
 		}
 	}
+	IndexRuns();
+}
+
+// Records the ends of the open runs along every row and column
+void Dungeon::IndexRuns()
+{
+	int R, C, end;
+
+	for (R = 0; R < 32; ++R)
+	{
+		end = 0;
+		for (C = 0; C < 32; ++C)
+		{
+			if (!IsOpen(R, C))
+			{
+				end = C + 1;
+				continue;
+			}
+			runW[RC2IDX(R, C)] = end;
+		}
+		end = 31;
+		for (C = 31; C >= 0; --C)
+		{
+			if (!IsOpen(R, C))
+			{
+				end = C - 1;
+				continue;
+			}
+			runE[RC2IDX(R, C)] = end;
+		}
+	}
+
+	for (C = 0; C < 32; ++C)
+	{
+		end = 0;
+		for (R = 0; R < 32; ++R)
+		{
+			if (!IsOpen(R, C))
+			{
+				end = R + 1;
+				continue;
+			}
+			runN[RC2IDX(R, C)] = end;
+		}
+		end = 31;
+		for (R = 31; R >= 0; --R)
+		{
+			if (!IsOpen(R, C))
+			{
+				end = R - 1;
+				continue;
+			}
+			runS[RC2IDX(R, C)] = end;
+		}
+	}
+}
+
+// Checks for a clear straight line from R/C to R2/C2 along
+// a row or column: every cell after R/C, up to and including
+// R2/C2, must be open.  This is what walking there one STEPOK
+// at a time would find.
+bool Dungeon::InSight(dodBYTE R, dodBYTE C, dodBYTE R2, dodBYTE C2)
+{
+	int idx = RC2IDX(R2, C2);
+
+	if (!IsOpen(R2, C2)) return false;
+	if (R == R2)
+	{
+		if (C < C2) return runW[idx] <= C + 1;
+		if (C > C2) return runE[idx] >= C - 1;
+	}
+	else if (C == C2)
+	{
+		if (R < R2) return runN[idx] <= R + 1;
+		if (R > R2) return runS[idx] >= R - 1;
+	}
+	return false;
 }
 
 // Checks if a step can be taken from the given row/col
@@ -479,9 +601,7 @@ bool Dungeon::STEPOK(dodBYTE R, dodBYTE C, dodBYTE dir)
 {
 	R += STPTAB[dir * 2];
 	C += STPTAB[(dir * 2) + 1];
-	if (BORDER(R,C) == false) return false;
-	if (MAZLND[RC2IDX(R,C)] == 255) return false;
-	return true;
+	return IsOpen(R, C);
 }
 
 //Sets original vertical feature table values.
@@ -571,7 +691,7 @@ void Dungeon::SetVFTTABRandomMap()
 void Dungeon::SetLEVTABRandomMap()
 {
 	//srand(GetTickCount());
-        srand(SDL_GetTicks());
+        srand(DOD_GetTicks());
 	LEVTAB[0] = rand() & 255;
 	LEVTAB[1] = rand() & 255;
 	LEVTAB[2] = rand() & 255;
@@ -20,7 +20,7 @@ is held by Douglas J. Morgan.
 
 #include "dod.h"
 
-extern RNG rng;	// Inculded here for inlines below
+extern DOD_CONTEXT_LOCAL RNG &rng;	// Inculded here for inlines below
 
 class Dungeon
 {
@@ -39,16 +39,31 @@ public:
 	// Public Interface
 	void	DGNGEN();
 	void	CalcVFI();
-	int		RC2IDX(dodBYTE R, dodBYTE C);
+	static int	RC2IDX(dodBYTE R, dodBYTE C);
+	bool	IsOpen(dodBYTE R, dodBYTE C);
+	dodBYTE	SideCode(dodBYTE R, dodBYTE C, dodBYTE dir);
+	void	PackMaze();
+	void	UnpackMaze();
 	bool	STEPOK(dodBYTE R, dodBYTE C, dodBYTE dir);
+	bool	InSight(dodBYTE R, dodBYTE C, dodBYTE R2, dodBYTE C2);
 	dodBYTE	VFIND(RowCol rc);
 	bool	TryMove(dodBYTE dir);
 
 	// Public Data Fields
 	dodBYTE		MAZLND[1024];	// The Maze
-	dodBYTE		NEIBOR[9];		// The cells around the player
-								// Also used to store the walls/doors
-								// of a given cell (for the 3D-Viewer)
+
+	// The maze again as bit planes: word R is row R, bit C is
+	// column C.  A side is shared by the two cells it divides,
+	// so only north and west sides are kept; the outer edge is
+	// always a wall.  Edge planes are indexed by HF_ code - 1.
+	// DGNGEN builds these and fills MAZLND from them; loading a
+	// game goes the other way with PackMaze().
+	typedef dodLONG	Plane[32];
+	Plane		openCells;		// Cells that are not solid rock
+	Plane		hEdge[3];		// North side of each cell
+	Plane		vEdge[3];		// West side of each cell
+	dodBYTE		NEIBOR[9];		// The walls/doors of a given cell
+								// (for the 3D-Viewer)
 	dodBYTE		LEVTAB[7];		// The RNG seeds
 	RowCol		DROW;
 	int			STPTAB[8];
@@ -76,15 +91,22 @@ public:
 private:
 	// Private Implementation
 	bool	BORDER(dodBYTE R, dodBYTE C);
-	void	MAKDOR(dodBYTE * table);
-	void	FRIEND(RowCol RC);
+	void	MAKDOR(dodBYTE code);
+	bool	MakesBlock(dodBYTE R, dodBYTE C);
+	Plane *	SideEdge(dodBYTE & R, dodBYTE & C, dodBYTE dir);
+	void	IndexRuns();
 	void	RndDstDir(dodBYTE * DIR, dodBYTE * DST);
 	bool	VFINDsub(dodBYTE & a, int & u, RowCol * rc);
 
 	// Data Fields
-	dodBYTE		MSKTAB[4];
-	dodBYTE		DORTAB[4];
-	dodBYTE		SDRTAB[4];
+
+	// Ends of the open run through each open cell, along its
+	// row (runW/runE are columns) and its column (runN/runS
+	// are rows).  Rebuilt with the planes; see IndexRuns().
+	dodBYTE		runW[1024];
+	dodBYTE		runE[1024];
+	dodBYTE		runN[1024];
+	dodBYTE		runS[1024];
 
 	// Scaffolding Data Fields
 	char NS[4];
@@ -106,6 +128,12 @@ inline bool Dungeon::BORDER(dodBYTE R, dodBYTE C)
 	return true;
 }
 
+inline bool Dungeon::IsOpen(dodBYTE R, dodBYTE C)
+{
+	if (BORDER(R, C) == false) return false;
+	return ((openCells[R] >> C) & 1) != 0;
+}
+
 inline int Dungeon::RC2IDX(dodBYTE R, dodBYTE C)
 {
 	R &= 31;
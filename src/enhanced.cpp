@@ -3,13 +3,15 @@
 #include "dodgame.h"
 #include "parser.h"
 #include "enhanced.h"
+#include "sched.h"
 
-extern OS_Link	oslink;
-extern dodGame	game;
+extern DOD_CONTEXT_LOCAL OS_Link	&oslink;
+extern DOD_CONTEXT_LOCAL dodGame	&game;
+extern DOD_CONTEXT_LOCAL Scheduler	&scheduler;
 
 // these globals hold the options and cheat flag bits
-unsigned int g_options=OPT_STEREO|OPT_ARTIFACT; // Artifact colors ON by default
-unsigned int g_cheats=0;
+DOD_CONTEXT_LOCAL unsigned int g_options=OPT_STEREO|OPT_ARTIFACT; // Artifact colors ON by default
+DOD_CONTEXT_LOCAL unsigned int g_cheats=0;
 
 // translate a DOD string into a standard C string
 void GetDodStr(char *pstr, dodBYTE *dodstr)
@@ -47,7 +49,7 @@ void SetDodStr(dodBYTE *dodstr, std::string pstr)
 	char c;
 	for (x=0; x < pstr.length();x++) { // for each character in pstr
 		c=toupper(pstr[x]);		// convert it to uppercase
-		if (c>='A' || c<='Z')
+		if (c>='A' && c<='Z')
 			dodstr[x]=c-64;
 		else
 			dodstr[x]=Parser::I_SP; // replace it with a space
@@ -183,6 +185,38 @@ bool SetOption(char *opt)
 			bSuccess = true;
 		}
 	}
+	else if (0==strncmp(name,"PROFILE",nlen) && vlen) {
+		if (0==strncmp(value,"ON",vlen)) {
+			// start timing scheduler tasks
+			scheduler.profiler.enabled = true;
+			bSuccess = true;
+		}
+		else if (0==strncmp(value,"OFF",vlen)) {
+			// stop timing, keep what was collected
+			scheduler.profiler.enabled = false;
+			bSuccess = true;
+		}
+		else if (0==strncmp(value,"RESET",vlen)) {
+			// throw away what was collected
+			scheduler.profiler.reset();
+			bSuccess = true;
+		}
+		else if (0==strncmp(value,"DUMP",vlen)) {
+			// write the report now
+			bSuccess = oslink.dumpProfile();
+		}
+	}
+	else if (0==strncmp(name,"TRACE",nlen) && vlen) {
+		if (0==strncmp(value,"ON",vlen)) {
+			// start recording a timeline
+			bSuccess = oslink.startTrace();
+		}
+		else if (0==strncmp(value,"OFF",vlen)) {
+			// finish the timeline file
+			oslink.tracer.stop();
+			bSuccess = true;
+		}
+	}
 	else if (0==strncmp(name,"CRI",3)) {
 		if (nlen > 3 && 0==strncmp(name+3,"GNOREOBJECTS",nlen-3) && vlen) {
 			if (0==strncmp(value,"TRUE",vlen)) {
@@ -267,6 +301,27 @@ bool SetCheat(char *str)
 	return false;
 }
 
+// parse the optional count after REWIND.  The keyboard has no
+// digits, so counts are spelled out: REWIND THREE
+int ParseRewindSteps(char *str)
+{
+	static const char *words[] = {"ONE","TWO","THREE","FOUR","FIVE",
+								  "SIX","SEVEN","EIGHT","NINE","TEN"};
+	char name[255];
+	char value[255];
+
+	ParseOpt(str,name,value);
+
+	int len=strlen(name);
+	if (!len) return 1; // no count, latest snapshot
+
+	for (int x=0;x<(int)(sizeof(words)/sizeof(words[0]));x++) {
+		if (0==strcmp(name,words[x]))
+			return x+1;
+	}
+	return 0;
+}
+
 bool PreTranslateCommand(dodBYTE *str)
 {
 	char buffer[256];
@@ -303,6 +358,15 @@ bool PreTranslateCommand(dodBYTE *str)
 			return true;
 		}
 	}
+	else if (0==strncmp(pBuffer,"REWIND",6) &&
+			 (pBuffer[6]=='\0' || pBuffer[6]==' ')) {
+		int steps=ParseRewindSteps(pBuffer+6);
+		if (steps) {
+			SetDodStr(str,"");
+			scheduler.requestRewind(steps);
+			return true;
+		}
+	}
 	else if (0==strncmp(pBuffer,"RESTART", 7)) {
 		SetDodStr(str,"");
 		return false;
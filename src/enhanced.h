@@ -1,6 +1,7 @@
 bool PreTranslateCommand(dodBYTE *str);
+void SetDodStr(dodBYTE *dodstr, std::string pstr);
 
-extern unsigned int g_options;
+extern DOD_CONTEXT_LOCAL unsigned int g_options;
 
 enum {
 	OPT_VECTOR=1,
@@ -8,9 +9,11 @@ enum {
 	OPT_STEREO=4,
 	OPT_ARTIFACT=8,       // NTSC artifact color emulation
 	OPT_ARTIFACT_FLIP=16, // Flip cyan/orange phase
+	OPT_SCANLINES=32,     // Darken alternate half rows
+	OPT_PHOSPHOR=64,      // Let the last frame fade out
 };
 
-extern unsigned int g_cheats;
+extern DOD_CONTEXT_LOCAL unsigned int g_cheats;
 
 enum {
 	CHEAT_TORCH			=0x01,
@@ -0,0 +1,33 @@
+/*
+ * glyph_shader.h - Embedded GLSL shaders for batched text
+ *
+ * WebGL 1.0 / GLSL ES 1.0 compatible, like artifact_shader.h.  The
+ * vertices arrive in window coordinates, already placed by the CPU
+ * exactly where the glTranslatef() walk used to put them.
+ */
+
+#ifndef DOD_GLYPH_SHADER_HEADER
+#define DOD_GLYPH_SHADER_HEADER
+
+// Vertex Shader - window coordinates to clip space, as glOrtho does
+static const char* GLYPH_VERTEX_SHADER =
+    "attribute vec2 a_position;\n"
+    "uniform vec4 u_screen;  // window to clip space: scale xy, offset zw\n"
+    "\n"
+    "void main() {\n"
+    "    gl_Position = vec4(a_position * u_screen.xy + u_screen.zw, 0.0, 1.0);\n"
+    "}\n";
+
+// Fragment Shader - flat text color
+static const char* GLYPH_FRAGMENT_SHADER =
+    "#ifdef GL_ES\n"
+    "precision mediump float;\n"
+    "#endif\n"
+    "\n"
+    "uniform vec3 u_color;\n"
+    "\n"
+    "void main() {\n"
+    "    gl_FragColor = vec4(u_color, 1.0);\n"
+    "}\n";
+
+#endif // DOD_GLYPH_SHADER_HEADER
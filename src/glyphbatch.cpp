@@ -0,0 +1,180 @@
+/*
+ * glyphbatch.cpp - Batched text drawing
+ */
+
+#include "glyphbatch.h"
+#include "glyph_shader.h"
+#include "oslink.h"
+#include "shader.h"
+#include <cstdio>
+
+extern DOD_CONTEXT_LOCAL OS_Link &oslink;
+extern DOD_CONTEXT_LOCAL Coordinate &crd;
+
+GlyphBatch::GlyphBatch()
+    : m_scaledWidth(0.0f)
+    , m_scaledHeight(0.0f)
+    , m_program(0)
+    , m_vertexShader(0)
+    , m_fragmentShader(0)
+    , m_vbo(0)
+    , m_screenLoc(-1)
+    , m_colorLoc(-1)
+    , m_initialized(false)
+{
+    for (int ctr = 0; ctr < 128; ++ctr) {
+        m_glyphs[ctr].first = 0;
+        m_glyphs[ctr].count = 0;
+    }
+}
+
+GlyphBatch::~GlyphBatch()
+{
+    shutdown();
+}
+
+bool GlyphBatch::init()
+{
+    if (m_initialized) {
+        return true;
+    }
+
+    m_vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    m_fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    if (!shaderMgr.compileShader(m_vertexShader, GLYPH_VERTEX_SHADER) ||
+        !shaderMgr.compileShader(m_fragmentShader, GLYPH_FRAGMENT_SHADER)) {
+        fprintf(stderr, "GlyphBatch: Shader compilation failed\n");
+        shutdown();
+        return false;
+    }
+
+    m_program = glCreateProgram();
+    glAttachShader(m_program, m_vertexShader);
+    glAttachShader(m_program, m_fragmentShader);
+    glBindAttribLocation(m_program, 0, "a_position");
+    if (!shaderMgr.linkProgram(m_program)) {
+        fprintf(stderr, "GlyphBatch: Program linking failed\n");
+        shutdown();
+        return false;
+    }
+
+    m_screenLoc = glGetUniformLocation(m_program, "u_screen");
+    m_colorLoc = glGetUniformLocation(m_program, "u_color");
+
+    glGenBuffers(1, &m_vbo);
+
+    m_initialized = true;
+    return true;
+}
+
+void GlyphBatch::shutdown()
+{
+    if (m_vbo) {
+        glDeleteBuffers(1, &m_vbo);
+        m_vbo = 0;
+    }
+    if (m_program) {
+        glDeleteProgram(m_program);
+        m_program = 0;
+    }
+    if (m_vertexShader) {
+        glDeleteShader(m_vertexShader);
+        m_vertexShader = 0;
+    }
+    if (m_fragmentShader) {
+        glDeleteShader(m_fragmentShader);
+        m_fragmentShader = 0;
+    }
+    m_vertices.clear();
+    m_initialized = false;
+}
+
+void GlyphBatch::setGlyph(char c, const dodBYTE* vaq)
+{
+    Glyph& glyph = m_glyphs[c & 127];
+    glyph.first = (int)(m_shapes.size() / 2);
+
+    // Each quad of the list as two triangles
+    static const int corners[6] = {0, 1, 2, 0, 2, 3};
+    int numQuads = vaq[0];
+    for (int curQuad = 0; curQuad < numQuads; ++curQuad) {
+        const dodBYTE* quad = vaq + 1 + curQuad * 8;
+        for (int ctr = 0; ctr < 6; ++ctr) {
+            m_shapes.push_back((GLshort)quad[corners[ctr] * 2]);
+            m_shapes.push_back((GLshort)quad[corners[ctr] * 2 + 1]);
+        }
+    }
+
+    glyph.count = (int)(m_shapes.size() / 2) - glyph.first;
+    m_scaledWidth = 0.0f; // rescale() with the new glyph
+}
+
+// Scales the glyphs with crd.newXa()/newYa(), as drawVectorListAQ()
+// does, whenever the window size has changed
+void GlyphBatch::rescale()
+{
+    GLfloat width = crd.newXa(256.0), height = crd.newYa(192.0);
+    if (width == m_scaledWidth && height == m_scaledHeight) {
+        return;
+    }
+    m_scaled.resize(m_shapes.size());
+    for (size_t ctr = 0; ctr < m_shapes.size(); ctr += 2) {
+        m_scaled[ctr] = crd.newXa((double)m_shapes[ctr]);
+        m_scaled[ctr + 1] = crd.newYa((double)m_shapes[ctr + 1]);
+    }
+    m_scaledWidth = width;
+    m_scaledHeight = height;
+}
+
+void GlyphBatch::add(int x, int y, const char* str, int len)
+{
+    if (!m_initialized) {
+        return;
+    }
+    rescale();
+
+    // Accumulated the way glTranslatef() accumulated the
+    // modelview, so every glyph lands on the same pixels
+    GLfloat originX = crd.newX(x * 8);
+    GLfloat originY = crd.newY((y + 1) * 8);
+    GLfloat advance = crd.newXa(8);
+    for (int ctr = 0; ctr < len; ++ctr) {
+        const Glyph& glyph = m_glyphs[str[ctr] & 127];
+        const GLfloat* vertex = glyph.count ? &m_scaled[glyph.first * 2] : NULL;
+        for (int vtx = 0; vtx < glyph.count; ++vtx) {
+            m_vertices.push_back(originX + vertex[0]);
+            m_vertices.push_back(originY + vertex[1]);
+            vertex += 2;
+        }
+        originX += advance;
+    }
+}
+
+bool GlyphBatch::draw(const GLfloat color[3])
+{
+    if (!m_initialized) {
+        return false;
+    }
+    if (m_vertices.empty()) {
+        return true;
+    }
+
+    float w = (float)oslink.width, h = (float)oslink.height;
+
+    glUseProgram(m_program);
+    glUniform4f(m_screenLoc, 2.0f / w, 2.0f / h, -1.0f, -1.0f);
+    glUniform3fv(m_colorLoc, 1, color);
+
+    glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
+    glBufferData(GL_ARRAY_BUFFER, m_vertices.size() * sizeof(GLfloat),
+                 &m_vertices[0], GL_STREAM_DRAW);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, (void*)0);
+    glDrawArrays(GL_TRIANGLES, 0, (GLsizei)(m_vertices.size() / 2));
+    glDisableVertexAttribArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glUseProgram(0);
+
+    m_vertices.clear();
+    return true;
+}
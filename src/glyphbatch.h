@@ -0,0 +1,72 @@
+/*
+ * glyphbatch.h - Batched text drawing
+ *
+ * The font is a set of quad lists (AZ_VLA), one per character.  The
+ * status line, the prompt area and the examine area are redrawn every
+ * frame, and drawing them a character at a time meant a glTranslatef()
+ * and a glBegin()/glEnd() block per character: over 600 of them for a
+ * full examine screen.
+ *
+ * The batch keeps each glyph as a triangle list, scaled to the screen
+ * once per window size.  Strings are appended as vertices at their
+ * text cell, and draw() sends the whole batch with one glDrawArrays.
+ * Until init() succeeds, callers keep the immediate-mode path.
+ */
+
+#ifndef DOD_GLYPHBATCH_HEADER
+#define DOD_GLYPHBATCH_HEADER
+
+#include "dod.h"
+#include <vector>
+
+class GlyphBatch {
+public:
+    GlyphBatch();
+    ~GlyphBatch();
+
+    // Compiles the shader; needs a current GL context
+    bool init();
+    void shutdown();
+
+    // Uses the quad list "vaq" (drawVectorListAQ() format) for "c"
+    void setGlyph(char c, const dodBYTE* vaq);
+
+    // Appends "len" characters at text column x, row y, the
+    // position drawString() would draw them at
+    void add(int x, int y, const char* str, int len);
+
+    // Draws and empties the batch.  False if nothing was drawn
+    // because the shader is not available.
+    bool draw(const GLfloat color[3]);
+
+    bool isInitialized() const { return m_initialized; }
+
+private:
+    struct Glyph {
+        int first; // in vertices
+        int count;
+    };
+
+    void rescale();
+
+    Glyph m_glyphs[128];
+    std::vector<GLshort> m_shapes;   // glyph triangles, DoD units
+    std::vector<GLfloat> m_scaled;   // the same, in window units
+    GLfloat m_scaledWidth;           // screen size m_scaled is for
+    GLfloat m_scaledHeight;
+    std::vector<GLfloat> m_vertices; // the batch, window coordinates
+
+    GLuint m_program;
+    GLuint m_vertexShader;
+    GLuint m_fragmentShader;
+    GLuint m_vbo;
+
+    GLint m_screenLoc;
+    GLint m_colorLoc;
+
+    bool m_initialized;
+};
+
+extern DOD_CONTEXT_LOCAL GlyphBatch &glyphBatch;
+
+#endif // DOD_GLYPHBATCH_HEADER
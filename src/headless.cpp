@@ -0,0 +1,180 @@
+/*
+ * headless.cpp - Driver for the headless simulation build
+ *
+ * Runs the game against the null platform layer in headless.h.  With
+ * no input arriving, the intro fade falls through to the demo, which
+ * then plays and restarts indefinitely.  Instead of sleeping between
+ * frames, the driver jumps the virtual clock straight to the next
+ * deadline, so simulated time runs as fast as the game logic allows.
+ *
+ * With -j, each of N threads runs its own independent game (see
+ * context.h) for the requested number of hours.
+ *
+ * With -p, each game runs with the scheduler profiler on (see
+ * profiler.h) and its report is printed at the end.  With -t, game N
+ * writes a timeline (see trace.h) to trace-N.json.
+ *
+ * With -a, writes the built-in vector art to a file (see vectorart.h),
+ * as a starting point for new art, and exits.
+ *
+ * Usage: dod-headless [-p] [-t] [-j threads] [hours]
+ *        dod-headless -a file
+ *        (default: 1 thread, 1 hour)
+ */
+
+#include "context.h"
+#include "dod.h"
+#include "dodgame.h"
+#include "oslink.h"
+#include "sched.h"
+#include "vectorart.h"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+extern DOD_CONTEXT_LOCAL dodGame &game;
+extern DOD_CONTEXT_LOCAL OS_Link &oslink;
+extern DOD_CONTEXT_LOCAL Scheduler &scheduler;
+
+// Starts at 1: the scheduler treats a zero frame time as "not started"
+thread_local Uint32 dodVirtualTicks = 1;
+
+Uint64 SDL_GetPerformanceCounter() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+Uint64 SDL_GetPerformanceFrequency() { return 1000000000; }
+
+// Runs the calling thread's game for the given number of simulated
+// hours and stores the number of frames it took, and the scheduler
+// profile if one was asked for.  A nonzero traceId records a timeline.
+static void runGame(double hours, unsigned long *frames,
+                    std::string *profile, int traceId) {
+  initGameContext();
+  oslink.init();
+  scheduler.profiler.enabled = (profile != NULL);
+  if (traceId != 0) {
+    char fn[32];
+    snprintf(fn, sizeof(fn), "trace-%d.json", traceId);
+    if (!oslink.tracer.start(fn)) {
+      fprintf(stderr, "Cannot write %s\n", fn);
+    }
+  }
+
+  Uint32 endTicks = dodVirtualTicks + static_cast<Uint32>(hours * 3600000.0);
+  unsigned long count = 0;
+
+  while (dodVirtualTicks < endTicks) {
+    main_game_loop(&oslink);
+    ++count;
+
+    // Skip idle time; always move forward at least one millisecond
+    Uint32 wake = game.nextWakeTime();
+    dodVirtualTicks = (wake > dodVirtualTicks) ? wake : dodVirtualTicks + 1;
+  }
+
+  *frames = count;
+  oslink.tracer.stop();
+  if (profile != NULL) {
+    *profile = scheduler.profiler.report();
+  }
+}
+
+int main(int argc, char *argv[]) {
+  // The game compares 32-bit millisecond ticks, which wrap after
+  // about 49 days, so keep runs well short of that.
+  const double maxHours = 1000.0;
+  const int maxThreads = 256;
+  double hours = 1.0;
+  int threads = 1;
+  bool profile = false;
+  bool trace = false;
+  const char *artFile = NULL;
+  bool ok = true;
+
+  for (int i = 1; i < argc && ok; ++i) {
+    if (strcmp(argv[i], "-p") == 0) {
+      profile = true;
+    } else if (strcmp(argv[i], "-t") == 0) {
+      trace = true;
+    } else if (strcmp(argv[i], "-a") == 0 && i + 1 < argc) {
+      artFile = argv[++i];
+    } else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+      threads = atoi(argv[++i]);
+      ok = (threads > 0 && threads <= maxThreads);
+    } else {
+      hours = atof(argv[i]);
+      ok = (hours > 0.0 && hours <= maxHours);
+    }
+  }
+  if (!ok) {
+    fprintf(stderr,
+            "Usage: %s [-p] [-t] [-j threads] [hours]  (0 < threads <= %d, "
+            "0 < hours <= %.0f)\n       %s -a file\n",
+            argv[0], maxThreads, maxHours, argv[0]);
+    return 1;
+  }
+
+  if (artFile != NULL) {
+    std::vector<unsigned char> art;
+    VectorArt::build(VectorData::lists, art);
+    FILE *fptr = fopen(artFile, "wb");
+    if (fptr == NULL || fwrite(&art[0], 1, art.size(), fptr) != art.size()) {
+      fprintf(stderr, "Cannot write %s\n", artFile);
+      ok = false;
+    }
+    if (fptr != NULL) {
+      ok = (fclose(fptr) == 0) && ok;
+    }
+    return ok ? 0 : 1;
+  }
+
+  std::vector<unsigned long> frames(threads, 0);
+  std::vector<std::string> profiles(threads);
+  std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+
+  if (threads == 1) {
+    runGame(hours, &frames[0], profile ? &profiles[0] : NULL, trace ? 1 : 0);
+  } else {
+    std::vector<std::thread> workers;
+    for (int i = 0; i < threads; ++i) {
+      workers.push_back(std::thread(runGame, hours, &frames[i],
+                                    profile ? &profiles[i] : NULL,
+                                    trace ? i + 1 : 0));
+    }
+    for (size_t i = 0; i < workers.size(); ++i) {
+      workers[i].join();
+    }
+  }
+
+  double wallSecs = std::chrono::duration<double>(
+                        std::chrono::steady_clock::now() - start)
+                        .count();
+  unsigned long totalFrames = 0;
+  for (int i = 0; i < threads; ++i) {
+    totalFrames += frames[i];
+  }
+  double totalHours = hours * threads;
+  printf("Simulated %.2f hours in %.2f s on %d thread%s "
+         "(%lu frames, %.0fx real time)\n",
+         totalHours, wallSecs, threads, (threads == 1) ? "" : "s",
+         totalFrames,
+         (wallSecs > 0.0) ? (totalHours * 3600.0) / wallSecs : 0.0);
+
+  for (int i = 0; profile && i < threads; ++i) {
+    printf("\nGame %d\n%s", i + 1, profiles[i].c_str());
+  }
+
+  // Worker games are torn down with the process.  With one game it
+  // ran on this thread, so close it; with several, this thread's
+  // context was never set up and must not be touched.
+  if (threads == 1) {
+    oslink.quitSDL(0);
+  }
+  return 0;
+}
@@ -0,0 +1,377 @@
+/*
+ * headless.h - Null platform layer for the headless simulation build
+ *
+ * Stands in for the SDL2, SDL_mixer and OpenGL headers when the game
+ * is compiled with DOD_HEADLESS (see the dod-headless make target).
+ * Video and audio calls do nothing, no input events ever arrive, and
+ * time comes from a virtual millisecond clock owned by headless.cpp,
+ * so game logic runs as fast as the CPU allows.
+ *
+ * Only the subset of each API that the game actually uses is
+ * declared here.  Constant values match the real headers.
+ */
+
+#ifndef DOD_HEADLESS_HEADER
+#define DOD_HEADLESS_HEADER
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Virtual clock, advanced by the headless driver and by DOD_Delay.
+// Each game thread keeps its own.
+extern thread_local uint32_t dodVirtualTicks;
+
+/*********************************************************************
+  SDL
+*********************************************************************/
+
+typedef uint8_t Uint8;
+typedef uint16_t Uint16;
+typedef uint32_t Uint32;
+typedef uint64_t Uint64;
+typedef int16_t Sint16;
+typedef int32_t Sint32;
+
+typedef Sint32 SDL_Keycode;
+
+typedef struct SDL_Keysym {
+  Sint32 scancode;
+  SDL_Keycode sym;
+  Uint16 mod;
+  Uint32 unused;
+} SDL_Keysym;
+
+typedef struct SDL_KeyboardEvent {
+  Uint32 type;
+  Uint32 timestamp;
+  Uint32 windowID;
+  Uint8 state;
+  Uint8 repeat;
+  SDL_Keysym keysym;
+} SDL_KeyboardEvent;
+
+typedef struct SDL_MouseButtonEvent {
+  Uint32 type;
+  Uint32 timestamp;
+  Uint32 windowID;
+  Uint32 which;
+  Uint8 button;
+  Uint8 state;
+  Uint8 clicks;
+  Sint32 x;
+  Sint32 y;
+} SDL_MouseButtonEvent;
+
+typedef union SDL_Event {
+  Uint32 type;
+  SDL_KeyboardEvent key;
+  SDL_MouseButtonEvent button;
+  Uint8 padding[56];
+} SDL_Event;
+
+typedef struct SDL_Window {
+  int unused;
+} SDL_Window;
+typedef void *SDL_GLContext;
+typedef struct SDL_mutex SDL_mutex;
+typedef struct SDL_sem SDL_sem;
+
+enum {
+  SDL_QUIT = 0x100,
+  SDL_KEYDOWN = 0x300,
+  SDL_KEYUP = 0x301,
+  SDL_MOUSEBUTTONDOWN = 0x401,
+};
+enum { SDL_WINDOWEVENT_EXPOSED = 3 };
+enum { SDL_RELEASED = 0, SDL_PRESSED = 1 };
+enum { SDL_DISABLE = 0, SDL_ENABLE = 1 };
+enum { SDL_BUTTON_LEFT = 1, SDL_BUTTON_RIGHT = 3 };
+enum {
+  SDL_INIT_TIMER = 0x01,
+  SDL_INIT_AUDIO = 0x10,
+  SDL_INIT_VIDEO = 0x20,
+};
+enum { SDL_WINDOW_FULLSCREEN = 0x01, SDL_WINDOW_OPENGL = 0x02 };
+#define SDL_WINDOWPOS_UNDEFINED 0x1FFF0000u
+
+typedef enum {
+  SDL_GL_RED_SIZE = 0,
+  SDL_GL_GREEN_SIZE = 1,
+  SDL_GL_BLUE_SIZE = 2,
+  SDL_GL_DOUBLEBUFFER = 5,
+  SDL_GL_DEPTH_SIZE = 6,
+  SDL_GL_CONTEXT_MAJOR_VERSION = 17,
+  SDL_GL_CONTEXT_MINOR_VERSION = 18,
+} SDL_GLattr;
+
+#define SDLK_SCANCODE_MASK (1 << 30)
+#define SDL_SCANCODE_TO_KEYCODE(X) ((X) | SDLK_SCANCODE_MASK)
+enum {
+  SDLK_BACKSPACE = '\b',
+  SDLK_TAB = '\t',
+  SDLK_RETURN = '\r',
+  SDLK_ESCAPE = '\033',
+  SDLK_SPACE = ' ',
+  SDLK_COMMA = ',',
+  SDLK_PERIOD = '.',
+  SDLK_SLASH = '/',
+  SDLK_SEMICOLON = ';',
+  SDLK_BACKQUOTE = '`',
+  SDLK_a = 'a', SDLK_b, SDLK_c, SDLK_d, SDLK_e, SDLK_f, SDLK_g,
+  SDLK_h, SDLK_i, SDLK_j, SDLK_k, SDLK_l, SDLK_m, SDLK_n,
+  SDLK_o, SDLK_p, SDLK_q, SDLK_r, SDLK_s, SDLK_t, SDLK_u,
+  SDLK_v, SDLK_w, SDLK_x, SDLK_y, SDLK_z,
+  SDLK_CAPSLOCK = SDL_SCANCODE_TO_KEYCODE(57),
+  SDLK_F5 = SDL_SCANCODE_TO_KEYCODE(62),
+  SDLK_SCROLLLOCK = SDL_SCANCODE_TO_KEYCODE(71),
+  SDLK_RIGHT = SDL_SCANCODE_TO_KEYCODE(79),
+  SDLK_LEFT = SDL_SCANCODE_TO_KEYCODE(80),
+  SDLK_DOWN = SDL_SCANCODE_TO_KEYCODE(81),
+  SDLK_UP = SDL_SCANCODE_TO_KEYCODE(82),
+  SDLK_NUMLOCKCLEAR = SDL_SCANCODE_TO_KEYCODE(83),
+  SDLK_APPLICATION = SDL_SCANCODE_TO_KEYCODE(101),
+  SDLK_LCTRL = SDL_SCANCODE_TO_KEYCODE(224),
+  SDLK_LSHIFT = SDL_SCANCODE_TO_KEYCODE(225),
+  SDLK_LALT = SDL_SCANCODE_TO_KEYCODE(226),
+  SDLK_LGUI = SDL_SCANCODE_TO_KEYCODE(227),
+  SDLK_RCTRL = SDL_SCANCODE_TO_KEYCODE(228),
+  SDLK_RSHIFT = SDL_SCANCODE_TO_KEYCODE(229),
+  SDLK_RALT = SDL_SCANCODE_TO_KEYCODE(230),
+  SDLK_RGUI = SDL_SCANCODE_TO_KEYCODE(231),
+  SDLK_MODE = SDL_SCANCODE_TO_KEYCODE(257),
+};
+
+#define SDL_TICKS_PASSED(A, B) ((Sint32)((B) - (A)) <= 0)
+
+inline int SDL_Init(Uint32) { return 0; }
+inline void SDL_Quit() {}
+inline const char *SDL_GetError() { return ""; }
+
+inline Uint32 SDL_GetTicks() { return dodVirtualTicks; }
+inline void SDL_Delay(Uint32 ms) { dodVirtualTicks += ms; }
+
+// The performance counter is real (wall clock) time, so the
+// scheduler profiler still measures what handlers actually cost
+Uint64 SDL_GetPerformanceCounter();
+Uint64 SDL_GetPerformanceFrequency();
+
+// No input ever arrives; a wait simply lets simulated time pass
+inline int SDL_PollEvent(SDL_Event *) { return 0; }
+inline int SDL_PushEvent(SDL_Event *) { return 1; }
+inline int SDL_WaitEventTimeout(SDL_Event *, int timeout) {
+  if (timeout > 0) {
+    dodVirtualTicks += static_cast<Uint32>(timeout);
+  }
+  return 0;
+}
+inline int SDL_ShowCursor(int) { return 0; }
+
+inline SDL_Window *SDL_CreateWindow(const char *, int, int, int, int, Uint32) {
+  static SDL_Window window;
+  return &window;
+}
+inline void SDL_SetWindowTitle(SDL_Window *, const char *) {}
+inline void SDL_SetWindowSize(SDL_Window *, int, int) {}
+inline int SDL_SetWindowFullscreen(SDL_Window *, Uint32) { return 0; }
+inline SDL_GLContext SDL_GL_CreateContext(SDL_Window *window) {
+  return window;
+}
+inline int SDL_GL_SetAttribute(SDL_GLattr, int) { return 0; }
+inline int SDL_GL_SetSwapInterval(int) { return 0; }
+inline void SDL_GL_SwapWindow(SDL_Window *) {}
+
+// Single-threaded: synchronisation objects are never created
+inline SDL_mutex *SDL_CreateMutex() { return NULL; }
+inline int SDL_LockMutex(SDL_mutex *) { return 0; }
+inline int SDL_UnlockMutex(SDL_mutex *) { return 0; }
+inline SDL_sem *SDL_CreateSemaphore(Uint32) { return NULL; }
+inline int SDL_SemPost(SDL_sem *) { return 0; }
+
+/*********************************************************************
+  SDL_mixer
+*********************************************************************/
+
+typedef struct Mix_Chunk {
+  int allocated;
+  Uint8 *abuf;
+  Uint32 alen;
+  Uint8 volume;
+} Mix_Chunk;
+
+#define MIX_MAX_VOLUME 128
+#define AUDIO_S16 0x8010
+
+inline int Mix_OpenAudio(int, Uint16, int, int) { return 0; }
+inline void Mix_CloseAudio() {}
+inline int Mix_AllocateChannels(int numchans) { return numchans; }
+inline Mix_Chunk *Mix_LoadWAV(const char *) { return NULL; }
+inline void Mix_ChannelFinished(void (*)(int)) {}
+// Sounds finish the moment they start
+inline int Mix_PlayChannel(int channel, Mix_Chunk *, int) { return channel; }
+inline int Mix_HaltChannel(int) { return 0; }
+inline int Mix_Playing(int) { return 0; }
+inline int Mix_Volume(int, int) { return MIX_MAX_VOLUME; }
+inline int Mix_SetPanning(int, Uint8, Uint8) { return 1; }
+
+/*********************************************************************
+  OpenGL
+*********************************************************************/
+
+typedef unsigned int GLenum;
+typedef unsigned char GLboolean;
+typedef unsigned int GLbitfield;
+typedef short GLshort;
+typedef int GLint;
+typedef int GLsizei;
+typedef unsigned int GLuint;
+typedef float GLfloat;
+typedef float GLclampf;
+typedef double GLdouble;
+typedef char GLchar;
+typedef ptrdiff_t GLsizeiptr;
+
+#define GL_FALSE 0
+#define GL_TRUE 1
+#define GL_POINTS 0x0000
+#define GL_LINES 0x0001
+#define GL_TRIANGLES 0x0004
+#define GL_TRIANGLE_STRIP 0x0005
+#define GL_QUADS 0x0007
+#define GL_LINE_SMOOTH 0x0B20
+#define GL_VIEWPORT 0x0BA2
+#define GL_UNPACK_ALIGNMENT 0x0CF5
+#define GL_TEXTURE_2D 0x0DE1
+#define GL_UNSIGNED_BYTE 0x1401
+#define GL_SHORT 0x1402
+#define GL_FLOAT 0x1406
+#define GL_MODELVIEW 0x1700
+#define GL_PROJECTION 0x1701
+#define GL_RGB 0x1907
+#define GL_LUMINANCE 0x1909
+#define GL_NEAREST 0x2600
+#define GL_TEXTURE_MAG_FILTER 0x2800
+#define GL_TEXTURE_MIN_FILTER 0x2801
+#define GL_TEXTURE_WRAP_S 0x2802
+#define GL_TEXTURE_WRAP_T 0x2803
+#define GL_VERTEX_ARRAY 0x8074
+#define GL_COLOR_ARRAY 0x8076
+#define GL_CLAMP_TO_EDGE 0x812F
+#define GL_TEXTURE0 0x84C0
+#define GL_TEXTURE1 0x84C1
+#define GL_TEXTURE2 0x84C2
+#define GL_ARRAY_BUFFER 0x8892
+#define GL_STREAM_DRAW 0x88E0
+#define GL_STATIC_DRAW 0x88E4
+#define GL_FRAGMENT_SHADER 0x8B30
+#define GL_VERTEX_SHADER 0x8B31
+#define GL_COMPILE_STATUS 0x8B81
+#define GL_LINK_STATUS 0x8B82
+#define GL_FRAMEBUFFER_COMPLETE 0x8CD5
+#define GL_COLOR_ATTACHMENT0 0x8CE0
+#define GL_FRAMEBUFFER 0x8D40
+#define GL_DEPTH_BUFFER_BIT 0x00000100
+#define GL_COLOR_BUFFER_BIT 0x00004000
+
+// Fixed-function drawing
+inline void glBegin(GLenum) {}
+inline void glEnd() {}
+inline void glVertex2f(GLfloat, GLfloat) {}
+inline void glColor3f(GLfloat, GLfloat, GLfloat) {}
+inline void glColor3fv(const GLfloat *) {}
+inline void glColor4fv(const GLfloat *) {}
+inline void glClear(GLbitfield) {}
+inline void glClearColor(GLclampf, GLclampf, GLclampf, GLclampf) {}
+inline void glEnable(GLenum) {}
+inline void glDisable(GLenum) {}
+inline void glViewport(GLint, GLint, GLsizei, GLsizei) {}
+inline void glMatrixMode(GLenum) {}
+inline void glLoadIdentity() {}
+inline void glOrtho(GLdouble, GLdouble, GLdouble, GLdouble, GLdouble,
+                    GLdouble) {}
+inline void glTranslatef(GLfloat, GLfloat, GLfloat) {}
+inline void glEnableClientState(GLenum) {}
+inline void glDisableClientState(GLenum) {}
+inline void glVertexPointer(GLint, GLenum, GLsizei, const void *) {}
+inline void glColorPointer(GLint, GLenum, GLsizei, const void *) {}
+
+// Textures, framebuffers and buffers.  Generated names are 0, and
+// framebuffers never complete, so the artifact shader stays disabled.
+inline void glGenTextures(GLsizei n, GLuint *names) {
+  memset(names, 0, n * sizeof(GLuint));
+}
+inline void glDeleteTextures(GLsizei, const GLuint *) {}
+inline void glBindTexture(GLenum, GLuint) {}
+inline void glActiveTexture(GLenum) {}
+inline void glTexParameteri(GLenum, GLenum, GLint) {}
+inline void glTexImage2D(GLenum, GLint, GLint, GLsizei, GLsizei, GLint,
+                         GLenum, GLenum, const void *) {}
+inline void glTexSubImage2D(GLenum, GLint, GLint, GLint, GLsizei, GLsizei,
+                            GLenum, GLenum, const void *) {}
+inline void glPixelStorei(GLenum, GLint) {}
+inline void glCopyTexImage2D(GLenum, GLint, GLenum, GLint, GLint, GLsizei,
+                             GLsizei, GLint) {}
+inline void glCopyTexSubImage2D(GLenum, GLint, GLint, GLint, GLint, GLint,
+                                GLsizei, GLsizei) {}
+inline void glGetIntegerv(GLenum, GLint *) {}
+inline void glGenFramebuffers(GLsizei n, GLuint *names) {
+  memset(names, 0, n * sizeof(GLuint));
+}
+inline void glDeleteFramebuffers(GLsizei, const GLuint *) {}
+inline void glBindFramebuffer(GLenum, GLuint) {}
+inline void glFramebufferTexture2D(GLenum, GLenum, GLenum, GLuint, GLint) {}
+inline GLenum glCheckFramebufferStatus(GLenum) { return 0; }
+inline void glGenBuffers(GLsizei n, GLuint *names) {
+  memset(names, 0, n * sizeof(GLuint));
+}
+inline void glDeleteBuffers(GLsizei, const GLuint *) {}
+inline void glBindBuffer(GLenum, GLuint) {}
+inline void glBufferData(GLenum, GLsizeiptr, const void *, GLenum) {}
+inline void glDrawArrays(GLenum, GLint, GLsizei) {}
+inline void glEnableVertexAttribArray(GLuint) {}
+inline void glDisableVertexAttribArray(GLuint) {}
+inline void glVertexAttribPointer(GLuint, GLint, GLenum, GLboolean, GLsizei,
+                                  const void *) {}
+
+// Shaders never compile or link
+inline GLuint glCreateShader(GLenum) { return 0; }
+inline void glDeleteShader(GLuint) {}
+inline void glShaderSource(GLuint, GLsizei, const GLchar *const *,
+                           const GLint *) {}
+inline void glCompileShader(GLuint) {}
+inline void glGetShaderiv(GLuint, GLenum, GLint *params) { *params = 0; }
+inline void glGetShaderInfoLog(GLuint, GLsizei, GLsizei *length,
+                               GLchar *log) {
+  if (length) {
+    *length = 0;
+  }
+  if (log) {
+    *log = '\0';
+  }
+}
+inline GLuint glCreateProgram() { return 0; }
+inline void glDeleteProgram(GLuint) {}
+inline void glAttachShader(GLuint, GLuint) {}
+inline void glBindAttribLocation(GLuint, GLuint, const GLchar *) {}
+inline void glLinkProgram(GLuint) {}
+inline void glGetProgramiv(GLuint, GLenum, GLint *params) { *params = 0; }
+inline void glGetProgramInfoLog(GLuint, GLsizei, GLsizei *length,
+                                GLchar *log) {
+  if (length) {
+    *length = 0;
+  }
+  if (log) {
+    *log = '\0';
+  }
+}
+inline void glUseProgram(GLuint) {}
+inline GLint glGetUniformLocation(GLuint, const GLchar *) { return -1; }
+inline void glUniform1f(GLint, GLfloat) {}
+inline void glUniform1i(GLint, GLint) {}
+inline void glUniform2f(GLint, GLfloat, GLfloat) {}
+inline void glUniform3fv(GLint, GLsizei, const GLfloat *) {}
+inline void glUniform4f(GLint, GLfloat, GLfloat, GLfloat, GLfloat) {}
+
+#endif // DOD_HEADLESS_HEADER
@@ -16,17 +16,66 @@ is held by Douglas J. Morgan.
 
 #include "object.h"
 #include "dodgame.h"
+#include "dungeon.h"
 #include "parser.h"
 #include "oslink.h"
 
-extern OS_Link	oslink;
-extern Parser	parser;
-extern dodGame	game;
+extern DOD_CONTEXT_LOCAL OS_Link	&oslink;
+extern DOD_CONTEXT_LOCAL Parser	&parser;
+extern DOD_CONTEXT_LOCAL dodGame	&game;
+
+// Object counts and levels, per creation pass, see CreateAll()
+const dodBYTE Object::OMXSTD[18] =
+{
+	0x41, 0x31, 0x31, 0x32, 0x23, 0x23, 0x11, 0x13, 0x16, 0x14, 0x14, 0x16,
+	0x01, 0x04, 0x08, 0x08, 0x03, 0x04
+};
+
+// As OMXSTD, with an extra vision scroll on level 1
+const dodBYTE Object::OMXVIS[18] =
+{
+	0x41, 0x31, 0x31, 0x32, 0x23, 0x23, 0x11, 0x04, 0x16, 0x14, 0x14, 0x16,
+	0x01, 0x04, 0x08, 0x08, 0x03, 0x04
+};
+
+// Weight and generic object type of each object class
+const dodBYTE Object::OBJWGT[6] =
+{
+	0x05, 0x01, 0x0A, 0x19, 0x19, 0x0A
+};
+
+const dodBYTE Object::GENVAL[6] =
+{
+	0xFF, 0xFF, 0xFF, 0x10, 0x11, 0x0F
+};
+
+// Compressed adjective and generic name lists, see Parser::EXPAND()
+const dodBYTE Object::ADJTAB[119] =
+{
+	0x19, 0x38, 0x67, 0x58, 0x48, 0xAD, 0x28, 0x28, 0x54, 0xFA, 0xB0, 0xA0,
+	0x31, 0x0A, 0xCB, 0x26, 0x68, 0x38, 0xDA, 0x9A, 0x22, 0x49, 0x60, 0x20,
+	0xA6, 0x52, 0xC8, 0x28, 0x28, 0x82, 0xDE, 0x60, 0x20, 0x64, 0x96, 0x94,
+	0x30, 0xAC, 0x99, 0xA5, 0xEE, 0x20, 0x02, 0x2C, 0x94, 0x20, 0x10, 0x16,
+	0x14, 0x29, 0x66, 0xF6, 0x06, 0x40, 0x30, 0xC5, 0x27, 0xBB, 0x45, 0x30,
+	0x6D, 0x56, 0x0C, 0x2E, 0x21, 0x13, 0x27, 0xB8, 0x29, 0x59, 0x57, 0x06,
+	0x40, 0x21, 0x60, 0x97, 0x14, 0x38, 0xD8, 0x50, 0xD1, 0x05, 0x90, 0x31,
+	0x2E, 0xF7, 0x90, 0xAE, 0x28, 0x4C, 0x97, 0x05, 0x80, 0x30, 0x4A, 0xE2,
+	0xC8, 0xF9, 0x18, 0x52, 0x32, 0x80, 0x20, 0x4C, 0x99, 0x14, 0x20, 0x4E,
+	0xF6, 0x10, 0x28, 0x0A, 0xD8, 0x53, 0x20, 0x21, 0x48, 0x50, 0x90
+};
+
+const dodBYTE Object::GENTAB[30] =
+{
+	0x06, 0x28, 0x0C, 0xC0, 0xCD, 0x60, 0x20, 0x64, 0x97, 0x1C, 0x30, 0xA6,
+	0x39, 0x3D, 0x8C, 0x30, 0xE6, 0x84, 0x95, 0x84, 0x29, 0x27, 0x77, 0xC8,
+	0x80, 0x29, 0x68, 0xF9, 0x0D, 0x00
+};
 
 // Constructor
 Object::Object()
 {
 	Reset();
+	Reindex();
 }
 
 void Object::Reset()
@@ -82,18 +131,9 @@ void Object::Reset()
 	}  //Do they want the shield fix?:
 
 	if (game.VisionScroll)  //Do we need an extra vision scroll in level 1?  Yes:
-		Utils::LoadFromHex(OMXTAB, "413131322323110416141416010408080304");
+		OMXTAB = OMXVIS;
 	else  //Do we need an extra vision scroll in level 1?  No:
-		Utils::LoadFromHex(OMXTAB, "413131322323111316141416010408080304");
-	Utils::LoadFromHex(OBJWGT, "05010A19190A");
-	Utils::LoadFromHex(GENVAL, "FFFFFF10110F");
-	Utils::LoadFromHex(ADJTAB,
-		"1938675848AD282854FAB0A0310ACB266838DA9A22496020A652C8282882DE60"
-		"2064969430AC99A5EE20022C94201016142966F6064030C527BB45306D560C2E"
-		"211327B829595706402160971438D850D10590312EF790AE284C970580304AE2"
-		"C8F918523280204C9914204EF610280AD8532021485090");
-	Utils::LoadFromHex(GENTAB,
-		"06280CC0CD602064971C30A6393D8C30E6849584292777C8802968F90D00");
+		OMXTAB = OMXSTD;
 }
 
 void Object::LoadSounds()
@@ -116,6 +156,7 @@ void Object::CreateAll()
 	{
 		OCBLND[x].clear();
 	}
+	Reindex();
 
 	do
 	{
@@ -139,40 +180,146 @@ void Object::CreateAll()
 	} while (a < 18);
 }
 
-// Finds object on the floor in a cell
-int Object::OFIND(RowCol rc)
+// Finds objects on the floor in a cell on this level.
+// Pass -1 for the first, then the previous result (still in
+// that cell) for the next.  Returns -1 when there are no more.
+int Object::NextInCell(RowCol rc, int idx)
 {
-	int idx;
-	do
+	if (idx == -1)
+	{
+		idx = cellHead[Dungeon::RC2IDX(rc.row, rc.col)];
+	}
+	else
+	{
+		idx = cellNext[idx];
+	}
+	while (idx != -1 && idx < OCBPTR)
 	{
-		idx = FNDOBJ();
-		if (idx == -1)
-			return -1;
-	} while ( (!((OCBLND[idx].P_OCROW == rc.row) && (OCBLND[idx].P_OCCOL == rc.col))) ||
-			 (OCBLND[idx].P_OCOWN != 0) );
+		if (OCBLND[idx].P_OCROW == rc.row &&
+			OCBLND[idx].P_OCCOL == rc.col &&
+			OCBLND[idx].P_OCLVL == game.LEVEL &&
+			OCBLND[idx].P_OCOWN == 0)
+		{
+			return idx;
+		}
+		idx = cellNext[idx];
+	}
+	return -1;
+}
+
+// Finds objects on this level, carried or not, lowest slot
+// first.  Pass -1 for the first, then the previous result for
+// the next.  Returns -1 when there are no more.
+int Object::NextOnLevel(int idx)
+{
+	if (idx == -1)
+	{
+		idx = levelHead[game.LEVEL];
+	}
+	else
+	{
+		idx = levelNext[idx];
+	}
+	if (idx >= OCBPTR)
+	{
+		return -1;
+	}
 	return idx;
 }
 
-// Finds objects in the OCB table
-int Object::FNDOBJ()
+// Moves an object to the given cell
+void Object::PlaceObject(int idx, dodBYTE rw, dodBYTE cl)
 {
-	int x = OFINDP;
-	if (OFINDF == 0)
+	UnlinkCell(idx);
+	OCBLND[idx].P_OCROW = rw;
+	OCBLND[idx].P_OCCOL = cl;
+	LinkCell(idx);
+}
+
+// Moves an object to the given level
+void Object::SetLevel(int idx, dodBYTE lvl)
+{
+	UnlinkLevel(idx);
+	OCBLND[idx].P_OCLVL = lvl;
+	LinkLevel(idx);
+}
+
+// Rebuilds the cell and level chains from OCBLND.  Needed
+// whenever OCBLND is changed other than through PlaceObject
+// and SetLevel.
+void Object::Reindex()
+{
+	int ctr;
+	for (ctr = 0; ctr < 1024; ++ctr)
 	{
-		x = -1;
-		OFINDF = -1;
+		cellHead[ctr] = -1;
 	}
+	for (ctr = 0; ctr < 5; ++ctr)
+	{
+		levelHead[ctr] = -1;
+	}
+	for (ctr = 71; ctr >= 0; --ctr)
+	{
+		cellNext[ctr] = -1;
+		LinkCell(ctr);
+		levelNext[ctr] = -1;
+		LinkLevel(ctr);
+	}
+}
 
-	do
+// Adds a slot to its cell's chain, keeping the chain in slot order
+void Object::LinkCell(int idx)
+{
+	int * link = &cellHead[Dungeon::RC2IDX(OCBLND[idx].P_OCROW,
+										   OCBLND[idx].P_OCCOL)];
+	while (*link != -1 && *link < idx)
 	{
-		++x;
-		OFINDP = x;
-		if (x == OCBPTR)
-		{
-			return -1;
-		}
-	} while (OCBLND[x].P_OCLVL != game.LEVEL);
-	return x;
+		link = &cellNext[*link];
+	}
+	cellNext[idx] = *link;
+	*link = idx;
+}
+
+void Object::UnlinkCell(int idx)
+{
+	int * link = &cellHead[Dungeon::RC2IDX(OCBLND[idx].P_OCROW,
+										   OCBLND[idx].P_OCCOL)];
+	while (*link != idx)
+	{
+		link = &cellNext[*link];
+	}
+	*link = cellNext[idx];
+}
+
+// Adds a slot to its level's chain, keeping the chain in slot
+// order.  Slots with no valid level are left out.
+void Object::LinkLevel(int idx)
+{
+	if (OCBLND[idx].P_OCLVL >= 5)
+	{
+		return;
+	}
+	int * link = &levelHead[OCBLND[idx].P_OCLVL];
+	while (*link != -1 && *link < idx)
+	{
+		link = &levelNext[*link];
+	}
+	levelNext[idx] = *link;
+	*link = idx;
+}
+
+void Object::UnlinkLevel(int idx)
+{
+	if (OCBLND[idx].P_OCLVL >= 5)
+	{
+		return;
+	}
+	int * link = &levelHead[OCBLND[idx].P_OCLVL];
+	while (*link != idx)
+	{
+		link = &levelNext[*link];
+	}
+	*link = levelNext[idx];
 }
 
 // Returns the object's name.
@@ -191,7 +338,7 @@ void Object::OBJNAM(int idx)
 	}
 
 	int ctr = 0;
-	dodBYTE * X;
+	const dodBYTE * X;
 	int Xup;
 	dodBYTE A;
 	
@@ -280,7 +427,7 @@ int Object::OBIRTH(dodBYTE OBJTYP, dodBYTE OBJLVL)
 	dodBYTE tmp;
 	int originalOCBPTR = OCBPTR;
 	OCBLND[OCBPTR].obj_id = OBJTYP;
-	OCBLND[OCBPTR].P_OCLVL = OBJLVL;
+	SetLevel(OCBPTR, OBJLVL);
 	OCBFIL(OBJTYP, OCBPTR);
 	if (GENVAL[OCBLND[OCBPTR].obj_type] != 0xFF)
 	{
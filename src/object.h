@@ -28,9 +28,12 @@ public:
 
 	// Public Interface
 	void	CreateAll();
-	int		FNDOBJ();
 	void	OBJNAM(int idx);
-	int		OFIND(RowCol rc);
+	int		NextOnLevel(int idx);
+	int		NextInCell(RowCol rc, int idx);
+	void	PlaceObject(int idx, dodBYTE rw, dodBYTE cl);
+	void	SetLevel(int idx, dodBYTE lvl);
+	void	Reindex();
 	int		OBIRTH(dodBYTE OBJCNT, dodBYTE OBJLVL);
 	void	OCBFIL(dodBYTE OBJTYP, int ptr);
 	bool	PAROBJ();
@@ -39,13 +42,13 @@ public:
 	
 	// Public Data Membes
 	OCB			OCBLND[72];		// Holds most of the object data
-	int			OFINDF;
-	dodBYTE		ADJTAB[119];
-	dodBYTE		GENTAB[30];
+	int			OFINDF;			// Unused; kept for the save layout
+	static const dodBYTE ADJTAB[119];
+	static const dodBYTE GENTAB[30];
 	dodBYTE		OBJTYP;
 	dodBYTE		OBJCLS;
 	dodBYTE		SPEFLG;
-	int			OBJWGT[6];
+	static const dodBYTE OBJWGT[6];
 	int			objChannel;
 	Mix_Chunk *	objSound[6];
 
@@ -92,14 +95,30 @@ public:
 	};
 
 	int			OCBPTR;
-	int			OFINDP;
+	int			OFINDP;			// Unused; kept for the save layout
 
 private:
+	void	LinkCell(int idx);
+	void	UnlinkCell(int idx);
+	void	LinkLevel(int idx);
+	void	UnlinkLevel(int idx);
+
 	// Data Fields
 	ODB			ODBTAB[25];
 	XDB			XXXTAB[11];
-	dodBYTE		OMXTAB[18];
-	dodBYTE		GENVAL[6];
+	const dodBYTE *	OMXTAB;		// OMXSTD or OMXVIS
+	static const dodBYTE OMXSTD[18];
+	static const dodBYTE OMXVIS[18];
+	static const dodBYTE GENVAL[6];
+
+	// Every OCBLND slot chained by its row and column, on any level
+	// and owned or not, lowest slot first.  See Reindex().
+	int			cellHead[1024];
+	int			cellNext[72];
+
+	// Every OCBLND slot chained by P_OCLVL, lowest slot first
+	int			levelHead[5];
+	int			levelNext[72];
 };
 
 #endif // DOD_OBJECT_HEADER
@@ -114,23 +114,27 @@ std::string formatTimestampForMenu(const std::string &raw) {
 #include "dodgame.h"
 #include "dungeon.h"
 #include "enhanced.h"
+#include "glyphbatch.h"
 #include "object.h"
 #include "oslink.h"
 #include "parser.h"
+#include "pixelbuf.h"
 #include "player.h"
 #include "sched.h"
 #include "shader.h"
+#include "vecstore.h"
+#include "viewcache.h"
 #include "viewer.h"
 
-extern Creature creature;
-extern Object object;
-extern Dungeon dungeon;
-extern Player player;
-extern Coordinate crd;
-extern Viewer viewer;
-extern dodGame game;
-extern Scheduler scheduler;
-extern Parser parser;
+extern DOD_CONTEXT_LOCAL Creature &creature;
+extern DOD_CONTEXT_LOCAL Object &object;
+extern DOD_CONTEXT_LOCAL Dungeon &dungeon;
+extern DOD_CONTEXT_LOCAL Player &player;
+extern DOD_CONTEXT_LOCAL Coordinate &crd;
+extern DOD_CONTEXT_LOCAL Viewer &viewer;
+extern DOD_CONTEXT_LOCAL dodGame &game;
+extern DOD_CONTEXT_LOCAL Scheduler &scheduler;
+extern DOD_CONTEXT_LOCAL Parser &parser;
 
 // Constructor
 OS_Link::OS_Link()
@@ -150,6 +154,7 @@ OS_Link::OS_Link()
   strcpy(confDir, "conf");
   strcpy(soundDir, "sound");
   strcpy(savedDir, "saved");
+  vectorArt[0] = '\0';
   memset(gamefile, 0, gamefileLen);
   memset(saveNameBuffer, 0, sizeof(saveNameBuffer));
 
@@ -247,6 +252,7 @@ bool OS_Link::loadSavedGame(const std::string& filename) {
   strcat(gamefile, ".dod");
 
   // Check if file exists with this name
+  scheduler.waitForSave(gamefile);
   FILE *fptr = fopen(gamefile, "r");
   if (fptr == NULL) {
     // Try lowercase version (for preloaded files like game.dod)
@@ -261,6 +267,7 @@ bool OS_Link::loadSavedGame(const std::string& filename) {
     strcat(gamefile, ".dod");
 
     // Final check with lowercase name
+    scheduler.waitForSave(gamefile);
     fptr = fopen(gamefile, "r");
     if (fptr == NULL) {
       return false;
@@ -306,6 +313,7 @@ bool OS_Link::deleteSavedGame(const std::string& filename) {
   strcat(filepath, upperFilename.c_str());
   strcat(filepath, ".dod");
 
+  scheduler.waitForSave(filepath);
   if (remove(filepath) == 0) {
     syncSavedGames(); // Sync deletion to persistent storage
     return true;
@@ -322,6 +330,7 @@ bool OS_Link::deleteSavedGame(const std::string& filename) {
   strcat(filepath, lowerFilename.c_str());
   strcat(filepath, ".dod");
 
+  scheduler.waitForSave(filepath);
   if (remove(filepath) == 0) {
     syncSavedGames(); // Sync deletion to persistent storage
     return true;
@@ -331,6 +340,8 @@ bool OS_Link::deleteSavedGame(const std::string& filename) {
 }
 
 void OS_Link::render() {
+  TraceScope frame(tracer, "frame", "frame");
+
   // All states go through the state machine
   bool runScheduler = game.updateState();
 
@@ -404,8 +415,12 @@ void OS_Link::render() {
     return;
   }
 
-  // Normal gameplay - run scheduler
+  // Normal gameplay - run scheduler.  Redraw requests made by
+  // tasks during the pass are coalesced into a single frame.
+  viewer.deferDraw = true;
   bool handle_res = scheduler.SCHED();
+  viewer.deferDraw = false;
+  viewer.draw_game();
 
   // If SCHED triggered a state change (e.g., death/victory fade), don't process result yet
   // Let the state machine handle it next frame
@@ -447,7 +462,9 @@ void OS_Link::render() {
 void main_game_loop(void *arg) {
   // Main game loop - called at browser frame rate
   // Game timing is handled by delta-time compensation in the scheduler
-  static_cast<OS_Link *>(arg)->render();
+  OS_Link *link = static_cast<OS_Link *>(arg);
+  link->render();
+  link->tracer.idle();
 }
 
 static void myError(GLenum error) {
@@ -463,6 +480,13 @@ static void myError(GLenum error) {
 void OS_Link::init() {
   loadOptFile();
 
+  // Alternative vector art, loaded before the GL setup stores it
+  if (vectorArt[0] != '\0') {
+    char fn[MAX_FILENAME_LENGTH * 2];
+    sprintf(fn, "%s%s%s", confDir, pathSep, vectorArt);
+    viewer.loadVectorArt(fn);
+  }
+
 #ifdef __EMSCRIPTEN__
   // Set up IDBFS for persistent saved games
   EM_ASM({
@@ -569,12 +593,38 @@ void OS_Link::init() {
   changeVideoRes(width); // All changing video res code was moved here
   SDL_SetWindowTitle(sdlWindow, "Dungeons of Daggorath");
 
+#ifdef DOD_HEADLESS
+  // The null GL in headless.h fails every shader compile and
+  // framebuffer check, so leave these subsystems uninitialized
+  // rather than have each report it.  Drawing then takes the
+  // immediate-mode paths, as after a failed init.
+  g_options &= ~OPT_ARTIFACT;
+#else
   // Initialize shader manager for NTSC artifact colors
   if (!shaderMgr.init()) {
     fprintf(stderr, "Warning: Shader initialization failed, artifact colors disabled\n");
     g_options &= ~OPT_ARTIFACT;
   }
 
+  // Upload the vector lists for the vector renderer
+  if (vecStore.init()) {
+    viewer.storeVectorLists();
+  }
+
+  // Software framebuffer for the NORMAL and HIRES line modes
+  pixelBuf.init();
+
+  // Batched text for the status, prompt and examine areas
+  if (glyphBatch.init()) {
+    viewer.storeGlyphs();
+  }
+
+  // Copies of the last 3D view and map walls, redrawn while
+  // nothing in them changes
+  viewCache.init();
+  mapCache.init();
+#endif
+
   //    std::cout << "After video res" << std::endl;
   memset(keys, parser.C_SP, keyLen);
 
@@ -653,9 +703,12 @@ void OS_Link::init() {
   std::cout << "After COMINI" << std::endl;
 #ifdef __EMSCRIPTEN__
   emscripten_set_main_loop_arg(main_game_loop, this, 0, 0);
+#elif defined(DOD_HEADLESS)
+  // headless.cpp drives the frame loop against the virtual clock
 #else
   while (1) {
     main_game_loop(this);
+    waitForWork();
   }
 #endif
   //    std::cout << "End of init" << std::endl;
@@ -689,8 +742,40 @@ void OS_Link::process_events() {
   }
 }
 
+// Desktop idle wait between frames.  Blocks until the
+// earliest pending deadline (scheduler task, animation step,
+// fade/menu frame or state timer) or until an input event
+// arrives, instead of spinning the main loop.  The event is
+// left in the queue for process_events()/keyCheck() to read.
+// The cap keeps sound-completion checks responsive, since
+// SDL_mixer finishing a channel does not raise an event.
+void OS_Link::waitForWork() {
+  const Uint32 maxIdleWait = 100;
+  Uint32 now = DOD_GetTicks();
+  Uint32 deadline = game.nextWakeTime();
+
+  if (SDL_TICKS_PASSED(now, deadline)) {
+    return;
+  }
+  Uint32 waitMs = deadline - now;
+  if (waitMs > maxIdleWait) {
+    waitMs = maxIdleWait;
+  }
+  SDL_WaitEventTimeout(NULL, static_cast<int>(waitMs));
+}
+
 // Quits application
 void OS_Link::quitSDL(int code) {
+  scheduler.finishSaves();
+  if (!scheduler.profiler.empty()) {
+    dumpProfile();
+  }
+  tracer.stop();
+  mapCache.shutdown();
+  viewCache.shutdown();
+  glyphBatch.shutdown();
+  pixelBuf.shutdown();
+  vecStore.shutdown();
   shaderMgr.shutdown();
   Mix_CloseAudio();
   SDL_Quit();
@@ -863,6 +948,10 @@ void OS_Link::handle_key_down(SDL_Keysym *keysym) {
       game.requestMenu();
       return;
 
+    case SDLK_F5:
+      scheduler.requestRewind(1); // same as REWIND
+      return;
+
     default:
       return;
     }
@@ -879,7 +968,7 @@ void OS_Link::handle_key_down(SDL_Keysym *keysym) {
             false - otherwise
 *********************************************************/
 bool OS_Link::main_menu() {
-#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_ASYNCIFY__)
+#if defined(DOD_NONBLOCKING)
   // Non-blocking: set up state and return
   game.requestMenu();
   return false;
@@ -1310,7 +1399,7 @@ bool OS_Link::menu_return(int menu_id, int item, menu Menu) {
 
 int OS_Link::menu_list(int x, int y, char *title, std::string list[],
                        int listSize) {
-#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_ASYNCIFY__)
+#if defined(DOD_NONBLOCKING)
   // Non-blocking: set up state and return pending
   game.menuX = x;
   game.menuY = y;
@@ -1382,7 +1471,7 @@ int OS_Link::menu_list(int x, int y, char *title, std::string list[],
  ******************************************************************************/
 
 int OS_Link::menu_scrollbar(std::string title, int min, int max, int current) {
-#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_ASYNCIFY__)
+#if defined(DOD_NONBLOCKING)
   // Non-blocking: set up state and return pending
   int range = max - min;
   if (range <= 0) {
@@ -1474,7 +1563,7 @@ int OS_Link::menu_scrollbar(std::string title, int min, int max, int current) {
  *             maxLength - The maximum size of the entry
  ******************************************************************************/
 void OS_Link::menu_string(char *newString, char *title, int maxLength) {
-#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_ASYNCIFY__)
+#if defined(DOD_NONBLOCKING)
   // Non-blocking: set up state and return
   *newString = '\0';
   game.menuTitle = title;
@@ -1621,6 +1710,9 @@ void OS_Link::loadOptFile(void) {
           volumeLevel = in;
       } else if (!strcmp(inputString, "saveDirectory")) {
         strncpy(savedDir, "saved", MAX_FILENAME_LENGTH);
+      } else if (!strcmp(inputString, "vectorArt")) {
+        strncpy(vectorArt, breakPoint, MAX_FILENAME_LENGTH);
+        vectorArt[MAX_FILENAME_LENGTH] = '\0';
       } else if (!strcmp(inputString, "fullScreen")) {
         if (1 == sscanf(breakPoint, "%d", &in))
           FullScreen = in;
@@ -1664,6 +1756,16 @@ void OS_Link::loadOptFile(void) {
           g_options |= OPT_ARTIFACT_FLIP;
         else
           g_options &= ~OPT_ARTIFACT_FLIP;
+      } else if (!strcmp(inputString, "scanlines")) {
+        if (!strcmp(breakPoint, "ON"))
+          g_options |= OPT_SCANLINES;
+        else
+          g_options &= ~OPT_SCANLINES;
+      } else if (!strcmp(inputString, "phosphor")) {
+        if (!strcmp(breakPoint, "ON"))
+          g_options |= OPT_PHOSPHOR;
+        else
+          g_options &= ~OPT_PHOSPHOR;
       }
     }
 
@@ -1698,6 +1800,8 @@ bool OS_Link::saveOptFile(void) {
   fout << "keylayout=" << keylayout << endl;
   fout << "volumeLevel=" << volumeLevel << endl;
   fout << "saveDirectory=" << savedDir << endl;
+  if (vectorArt[0] != '\0')
+    fout << "vectorArt=" << vectorArt << endl;
   fout << "fullScreen=" << FullScreen << endl;
   fout << "screenWidth=" << width << endl;
   fout << "creatureRegen=" << creatureRegen << endl;
@@ -1729,12 +1833,46 @@ bool OS_Link::saveOptFile(void) {
   fout << ((g_options & OPT_ARTIFACT) ? "ON" : "OFF") << endl;
   fout << "artifactPhase=";
   fout << ((g_options & OPT_ARTIFACT_FLIP) ? "FLIPPED" : "NORMAL") << endl;
+  fout << "scanlines=";
+  fout << ((g_options & OPT_SCANLINES) ? "ON" : "OFF") << endl;
+  fout << "phosphor=";
+  fout << ((g_options & OPT_PHOSPHOR) ? "ON" : "OFF") << endl;
 
   fout.close();
 
   return true;
 }
 
+/******************************************************************************
+ *  Function used to write the scheduler profile (see profiler.h)
+ *
+ *  Arguments: None
+ *
+ *  Returns:   true - file written successfully, false - file not written
+ ******************************************************************************/
+bool OS_Link::dumpProfile(void) {
+  char fn[MAX_FILENAME_LENGTH];
+
+  sprintf(fn, "%s%s%s", confDir, pathSep, "profile.txt");
+
+  return scheduler.profiler.dump(fn);
+}
+
+/******************************************************************************
+ *  Function used to start a timeline trace (see trace.h)
+ *
+ *  Arguments: None
+ *
+ *  Returns:   true - trace file opened, false - trace not started
+ ******************************************************************************/
+bool OS_Link::startTrace(void) {
+  char fn[MAX_FILENAME_LENGTH];
+
+  sprintf(fn, "%s%s%s", confDir, pathSep, "trace.json");
+
+  return tracer.start(fn);
+}
+
 /******************************************************************************
  *  Function used to load the options file from current settings
  *
@@ -1748,12 +1886,14 @@ void OS_Link::loadDefaults(void) {
   creature.creSpeedMul = 200;
   creature.UpdateCreSpeed();
   strcpy(savedDir, "saved");
+  vectorArt[0] = '\0';
   FullScreen = false;
   width = 1024;
   creatureRegen = 5;
   scheduler.updateCreatureRegen(creatureRegen);
 
-  g_options &= ~(OPT_VECTOR | OPT_HIRES | OPT_ARTIFACT_FLIP);
+  g_options &= ~(OPT_VECTOR | OPT_HIRES | OPT_ARTIFACT_FLIP | OPT_SCANLINES |
+                 OPT_PHOSPHOR);
   g_options |= OPT_STEREO | OPT_ARTIFACT;
   g_cheats = 0;
 
@@ -21,9 +21,12 @@ is held by Douglas J. Morgan.
 #define OS_LINK_HEADER
 
 #include "dod.h"
+#include "trace.h"
 
+#ifndef DOD_HEADLESS
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_opengl.h>
+#endif
 #include <string>
 #include <vector>
 
@@ -44,8 +47,11 @@ public:
 	void init();			// main entry point for dod application
 	void quitSDL(int code);	// shuts down SDL before exiting
 	void process_events();	// used mainly to retrieve keystrokes
+	void waitForWork();		// sleeps until the next game deadline or input
 	bool main_menu();       // used to implement the meta-menu
 	bool saveOptFile(void);
+	bool dumpProfile(void);	// writes the scheduler profile to conf/profile.txt
+	bool startTrace(void);	// starts a timeline trace in conf/trace.json
     void send_input(char * keys); // Send keys from external interfaces
     void sendCommand(const char * cmd); // Send a command string and execute it
     void stop_demo(); // Stop the demo / start game
@@ -87,6 +93,7 @@ public:
 	char	confDir[5];
 	char	soundDir[6];
 	char	savedDir[MAX_FILENAME_LENGTH + 1];
+	char	vectorArt[MAX_FILENAME_LENGTH + 1]; // in confDir, "" for built-in
 	char	saveNameBuffer[20];  // Buffer for save name input from menu
 	dodBYTE	keys[256];
 	int		keylayout;	// 0 = QWERTY, 1 = Dvorak
@@ -99,6 +106,8 @@ public:
 
 	SDL_Window * sdlWindow;
 
+	Tracer	tracer;	// timeline events, idle unless SETOPT TRACE ON
+
 private:
 	// Internal Implementation
 	void handle_key_down(SDL_Keysym * keysym);	// keyboard handler
@@ -17,7 +17,30 @@ is held by Douglas J. Morgan.
 #include "parser.h"
 #include "viewer.h"
 
-extern Viewer viewer;
+extern DOD_CONTEXT_LOCAL Viewer &viewer;
+
+// Compressed word lists and message, see EXPAND()
+const dodBYTE Parser::CMDTAB[69] =
+{
+	0x0F, 0x30, 0x03, 0x4A, 0x04, 0x6B, 0x28, 0x06, 0xC4, 0xB4, 0x40, 0x20,
+	0x09, 0x27, 0xC0, 0x38, 0x0B, 0x80, 0xB5, 0x2E, 0x28, 0x18, 0x0E, 0x5A,
+	0x00, 0x30, 0x12, 0xE1, 0x85, 0xD4, 0x20, 0x18, 0xF7, 0xAC, 0x20, 0x1A,
+	0xFB, 0x14, 0x20, 0x21, 0x56, 0x30, 0x30, 0x24, 0x5B, 0x14, 0x2C, 0x20,
+	0x27, 0x47, 0xDC, 0x20, 0x29, 0x59, 0x38, 0x18, 0x2B, 0x32, 0x80, 0x28,
+	0x34, 0xC7, 0x84, 0x80, 0x28, 0x35, 0x30, 0xD8, 0xA0
+};
+
+const dodBYTE Parser::DIRTAB[26] =
+{
+	0x06, 0x20, 0x18, 0x53, 0x50, 0x28, 0x24, 0x93, 0xA2, 0x80, 0x20, 0x04,
+	0x11, 0xAC, 0x30, 0x03, 0x27, 0xD5, 0xC4, 0x10, 0x2B, 0x00, 0x20, 0x08,
+	0xFB, 0xB8
+};
+
+const dodBYTE Parser::CERR[3] =
+{
+	0x17, 0x7B, 0xD0
+};
 
 // Constructor
 Parser::Parser() : LINPTR(0),
@@ -63,20 +86,6 @@ Parser::Parser() : LINPTR(0),
 	M_ERAS[3] = I_BAR;
 	M_ERAS[4] = I_BS;
 	M_ERAS[5] = I_NULL;
-
-	Utils::LoadFromHex(CERR, "177BD0");
-	Utils::LoadFromHex(CMDTAB, "0F30034A046B2806C4B440200927C0380B80B52E28180E5A003012E185D42018F7AC201AFB142021563030245B142C202747DC20295938182B32802834C78480283530D8A0");
-	Utils::LoadFromHex(DIRTAB, "0620185350282493A280200411AC300327D5C4102B002008FBB8");
-
-/*	Utils::LoadFromHex(CERR,"177BD0");
-
-	Utils::LoadFromHex(CMDTAB, 
-		"0F30034A046B2806C4B440200927C0380B80B52E28180E5A003012E185D42018F7AC20"
-		"1AFB142021563030245B142C202747DC20295938182B32802834C78480283530D8A0"
-		);
-
-	Utils::LoadFromHex(DIRTAB,
-		"0620185350282493A280200411AC300327D5C4102B002008FBB8");*/
 }
 
 void Parser::Reset()
@@ -135,7 +144,7 @@ dodBYTE Parser::KBDGET()
 // updated to a more C/C++ programming style, but for the moment
 // they work just fine.
 //
-int Parser::PARSER(dodBYTE * pTABLE, dodBYTE & A, dodBYTE & B, bool norm)
+int Parser::PARSER(const dodBYTE * pTABLE, dodBYTE & A, dodBYTE & B, bool norm)
 {
 	bool	tok;
 	int		U, Xup, Y;
@@ -259,7 +268,7 @@ GTOK30:
 	}
 }
 
-void Parser::EXPAND(dodBYTE * X, int * Xup, dodBYTE * U)
+void Parser::EXPAND(const dodBYTE * X, int * Xup, dodBYTE * U)
 {
 	dodBYTE * Y;
 	dodBYTE	A, B;
@@ -301,7 +310,7 @@ EXPAN10:
 	}
 }
 
-dodBYTE Parser::GETFIV(dodBYTE * X, int * Xup, dodBYTE * zeroY)
+dodBYTE Parser::GETFIV(const dodBYTE * X, int * Xup, dodBYTE * zeroY)
 {
 	dodBYTE		A, B;
 	
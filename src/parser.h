@@ -28,11 +28,11 @@ public:
 	// Public Interface
 	void	KBDPUT(dodBYTE c);
 	dodBYTE	KBDGET();
-	void	EXPAND(dodBYTE * X, int * Xup, dodBYTE * U);
-	dodBYTE	GETFIV(dodBYTE * X, int * Xup, dodBYTE * zeroY);
+	void	EXPAND(const dodBYTE * X, int * Xup, dodBYTE * U);
+	dodBYTE	GETFIV(const dodBYTE * X, int * Xup, dodBYTE * zeroY);
 	void	ASRD(dodBYTE & A, dodBYTE & B, int num);
 	bool	GETTOK();
-	int		PARSER(dodBYTE * X, dodBYTE &A, dodBYTE &B, bool norm);
+	int		PARSER(const dodBYTE * X, dodBYTE &A, dodBYTE &B, bool norm);
 	void	CMDERR();
 	int		PARHND();
 	void	Reset();
@@ -54,8 +54,8 @@ public:
 	dodBYTE		STRING[35];
 	dodBYTE		SWCHAR[11];
 	dodBYTE		OBJSTR[33];
-	dodBYTE		CMDTAB[69];
-	dodBYTE		DIRTAB[26];
+	static const dodBYTE CMDTAB[69];
+	static const dodBYTE DIRTAB[26];
 
 	enum {
 		C_BS=0x08,
@@ -102,7 +102,7 @@ public:
 	dodBYTE M_PROM1[5];
 	dodBYTE M_CURS[3];
 	dodBYTE M_ERAS[6];
-	dodBYTE CERR[3];
+	static const dodBYTE CERR[3];
 
 private:
 };
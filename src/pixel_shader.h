@@ -0,0 +1,40 @@
+/*
+ * pixel_shader.h - Embedded GLSL shaders for the software framebuffer
+ *
+ * WebGL 1.0 / GLSL ES 1.0 compatible, like artifact_shader.h.  Draws
+ * the PixelBuffer texture as one quad in the line color; unset texels
+ * are discarded so the cleared background shows through.
+ */
+
+#ifndef DOD_PIXEL_SHADER_HEADER
+#define DOD_PIXEL_SHADER_HEADER
+
+// Vertex Shader - places the unit quad over the canvas
+static const char* PIXEL_VERTEX_SHADER =
+    "attribute vec2 a_position;\n"
+    "uniform vec4 u_rect;    // clip space: bottom-left xy, size zw\n"
+    "varying vec2 v_texcoord;\n"
+    "\n"
+    "void main() {\n"
+    "    gl_Position = vec4(u_rect.xy + a_position * u_rect.zw, 0.0, 1.0);\n"
+    "    v_texcoord = vec2(a_position.x, 1.0 - a_position.y); // row 0 on top\n"
+    "}\n";
+
+// Fragment Shader - set pixels in the line color
+static const char* PIXEL_FRAGMENT_SHADER =
+    "#ifdef GL_ES\n"
+    "precision mediump float;\n"
+    "#endif\n"
+    "\n"
+    "varying vec2 v_texcoord;\n"
+    "uniform sampler2D u_texture;\n"
+    "uniform vec3 u_color;\n"
+    "\n"
+    "void main() {\n"
+    "    if (texture2D(u_texture, v_texcoord).r < 0.5) {\n"
+    "        discard;\n"
+    "    }\n"
+    "    gl_FragColor = vec4(u_color, 1.0);\n"
+    "}\n";
+
+#endif // DOD_PIXEL_SHADER_HEADER
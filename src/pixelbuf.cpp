@@ -0,0 +1,231 @@
+/*
+ * pixelbuf.cpp - Software framebuffer for the NORMAL and HIRES modes
+ */
+
+#include "pixelbuf.h"
+#include "pixel_shader.h"
+#include "oslink.h"
+#include "shader.h"
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+extern DOD_CONTEXT_LOCAL OS_Link &oslink;
+extern DOD_CONTEXT_LOCAL Coordinate &crd;
+
+PixelBuffer::PixelBuffer()
+    : m_width(0)
+    , m_height(0)
+    , m_left(0)
+    , m_top(0)
+    , m_hires(false)
+    , m_dirty(false)
+    , m_texWidth(0)
+    , m_texHeight(0)
+    , m_program(0)
+    , m_vertexShader(0)
+    , m_fragmentShader(0)
+    , m_texture(0)
+    , m_quadVBO(0)
+    , m_rectLoc(-1)
+    , m_textureLoc(-1)
+    , m_colorLoc(-1)
+    , m_initialized(false)
+{
+}
+
+PixelBuffer::~PixelBuffer()
+{
+    shutdown();
+}
+
+bool PixelBuffer::init()
+{
+    if (m_initialized) {
+        return true;
+    }
+
+    m_vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    m_fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    if (!shaderMgr.compileShader(m_vertexShader, PIXEL_VERTEX_SHADER) ||
+        !shaderMgr.compileShader(m_fragmentShader, PIXEL_FRAGMENT_SHADER)) {
+        fprintf(stderr, "PixelBuffer: Shader compilation failed\n");
+        shutdown();
+        return false;
+    }
+
+    m_program = glCreateProgram();
+    glAttachShader(m_program, m_vertexShader);
+    glAttachShader(m_program, m_fragmentShader);
+    glBindAttribLocation(m_program, 0, "a_position");
+    if (!shaderMgr.linkProgram(m_program)) {
+        fprintf(stderr, "PixelBuffer: Program linking failed\n");
+        shutdown();
+        return false;
+    }
+
+    m_rectLoc = glGetUniformLocation(m_program, "u_rect");
+    m_textureLoc = glGetUniformLocation(m_program, "u_texture");
+    m_colorLoc = glGetUniformLocation(m_program, "u_color");
+
+    // Unit quad, as a triangle strip
+    float quadVertices[] = {
+        0.0f, 0.0f,
+        1.0f, 0.0f,
+        0.0f, 1.0f,
+        1.0f, 1.0f,
+    };
+    glGenBuffers(1, &m_quadVBO);
+    glBindBuffer(GL_ARRAY_BUFFER, m_quadVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(quadVertices), quadVertices, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glGenTextures(1, &m_texture);
+    glBindTexture(GL_TEXTURE_2D, m_texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    m_initialized = true;
+    return true;
+}
+
+void PixelBuffer::shutdown()
+{
+    if (m_texture) {
+        glDeleteTextures(1, &m_texture);
+        m_texture = 0;
+    }
+    if (m_quadVBO) {
+        glDeleteBuffers(1, &m_quadVBO);
+        m_quadVBO = 0;
+    }
+    if (m_program) {
+        glDeleteProgram(m_program);
+        m_program = 0;
+    }
+    if (m_vertexShader) {
+        glDeleteShader(m_vertexShader);
+        m_vertexShader = 0;
+    }
+    if (m_fragmentShader) {
+        glDeleteShader(m_fragmentShader);
+        m_fragmentShader = 0;
+    }
+    m_texWidth = m_texHeight = 0;
+    m_dirty = false;
+    m_initialized = false;
+}
+
+// Sizes the canvas for the mode and screen, at the first
+// plot of a frame
+void PixelBuffer::resize(bool hires)
+{
+    int width = 256, height = 192;
+    if (hires) {
+        m_left = (int)floor(crd.newX(0.0));
+        int right = (int)ceil(crd.newX(256.0));
+        int bottom = (int)floor(crd.newY(192.0));
+        int top = (int)ceil(crd.newY(0.0));
+        m_top = top - 1;
+        width = right - m_left;
+        height = top - bottom;
+    }
+    m_hires = hires;
+    if (width != m_width || height != m_height) {
+        m_width = width;
+        m_height = height;
+        m_pixels.assign((size_t)m_width * m_height, 0);
+    }
+    m_dirty = true;
+}
+
+void PixelBuffer::plot(int x, int y)
+{
+    if (!m_dirty || m_hires) {
+        resize(false);
+    }
+    if (x >= 0 && x < m_width && y >= 0 && y < m_height) {
+        m_pixels[y * m_width + x] = 0xFF;
+    }
+}
+
+// Window pixel lit by a size 1 point at "w".  Rasterizers snap
+// vertices to 1/256 of a pixel first (the D3D10-class minimum,
+// and what Mesa does), so a point at 253.998 lights pixel 254.
+static int pointPixel(float w)
+{
+    return (int)floor(floor(w * 256.0f + 0.5f) / 256.0f);
+}
+
+// The pixel a GL_POINTS vertex at crd.newX(x), crd.newY(y) covers
+void PixelBuffer::plotHires(double x, double y)
+{
+    if (!m_dirty || !m_hires) {
+        resize(true);
+    }
+    int col = pointPixel(crd.newX(x)) - m_left;
+    int row = m_top - pointPixel(crd.newY(y));
+    if (col >= 0 && col < m_width && row >= 0 && row < m_height) {
+        m_pixels[row * m_width + col] = 0xFF;
+    }
+}
+
+void PixelBuffer::flush(const GLfloat color[3])
+{
+    if (!m_dirty) {
+        return;
+    }
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, m_texture);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    if (m_width != m_texWidth || m_height != m_texHeight) {
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_LUMINANCE, m_width, m_height, 0,
+                     GL_LUMINANCE, GL_UNSIGNED_BYTE, &m_pixels[0]);
+        m_texWidth = m_width;
+        m_texHeight = m_height;
+    } else {
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, m_width, m_height,
+                        GL_LUMINANCE, GL_UNSIGNED_BYTE, &m_pixels[0]);
+    }
+
+    // Canvas edges in window coordinates
+    float x0, x1, y0, y1;
+    if (m_hires) {
+        x0 = (float)m_left;
+        x1 = (float)(m_left + m_width);
+        y0 = (float)(m_top + 1 - m_height);
+        y1 = (float)(m_top + 1);
+    } else {
+        // Rows are stored top down, so a pixel center that falls
+        // exactly on a row boundary (when offY is fractional) would
+        // sample the row below.  Nudging the quad down a little
+        // keeps it in the row above, as the per-pixel quads did.
+        x0 = crd.newX(0.0);
+        x1 = crd.newX(256.0);
+        y0 = crd.newY(192.0) - 1.0f / 64.0f;
+        y1 = crd.newY(0.0) - 1.0f / 64.0f;
+    }
+    float w = (float)oslink.width, h = (float)oslink.height;
+
+    glUseProgram(m_program);
+    glUniform4f(m_rectLoc, 2.0f * x0 / w - 1.0f, 2.0f * y0 / h - 1.0f,
+                2.0f * (x1 - x0) / w, 2.0f * (y1 - y0) / h);
+    glUniform1i(m_textureLoc, 0);
+    glUniform3fv(m_colorLoc, 1, color);
+
+    glBindBuffer(GL_ARRAY_BUFFER, m_quadVBO);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    glDisableVertexAttribArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glUseProgram(0);
+
+    memset(&m_pixels[0], 0, m_pixels.size());
+    m_dirty = false;
+}
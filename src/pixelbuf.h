@@ -0,0 +1,70 @@
+/*
+ * pixelbuf.h - Software framebuffer for the NORMAL and HIRES modes
+ *
+ * The pixel modes draw the 3D view as dotted fade lines, one pixel at
+ * a time.  Viewer::drawVector() sets those pixels here instead of
+ * issuing a GL draw for each one.  When the frame is finished the
+ * buffer goes to the GPU as one texture upload and one quad, before
+ * the artifact shader (if any) resolves the frame.
+ *
+ * NORMAL mode uses a 256x192 canvas of CoCo pixels.  HIRES mode plots
+ * single screen pixels, so its canvas covers the 256x192 area at
+ * screen resolution.
+ */
+
+#ifndef DOD_PIXELBUF_HEADER
+#define DOD_PIXELBUF_HEADER
+
+#include "dod.h"
+#include <vector>
+
+class PixelBuffer {
+public:
+    PixelBuffer();
+    ~PixelBuffer();
+
+    // Compiles the shader; needs a current GL context
+    bool init();
+    void shutdown();
+
+    // Sets a CoCo pixel (NORMAL mode)
+    void plot(int x, int y);
+
+    // Sets the screen pixel under a DoD position (HIRES mode)
+    void plotHires(double x, double y);
+
+    // Draws and clears whatever was plotted since the last flush
+    void flush(const GLfloat color[3]);
+
+    bool isInitialized() const { return m_initialized; }
+
+private:
+    void resize(bool hires);
+
+    std::vector<unsigned char> m_pixels; // one byte per pixel, row 0 on top
+    int m_width;
+    int m_height;
+    int m_left;   // HIRES: window pixel of the canvas' left column
+    int m_top;    // HIRES: window pixel row of the canvas' top row
+    bool m_hires;
+    bool m_dirty;
+
+    int m_texWidth;
+    int m_texHeight;
+
+    GLuint m_program;
+    GLuint m_vertexShader;
+    GLuint m_fragmentShader;
+    GLuint m_texture;
+    GLuint m_quadVBO;
+
+    GLint m_rectLoc;
+    GLint m_textureLoc;
+    GLint m_colorLoc;
+
+    bool m_initialized;
+};
+
+extern DOD_CONTEXT_LOCAL PixelBuffer &pixelBuf;
+
+#endif // DOD_PIXELBUF_HEADER
@@ -25,14 +25,14 @@ is held by Douglas J. Morgan.
 #include "sched.h"
 #include "viewer.h"
 
-extern OS_Link oslink;
-extern Creature creature;
-extern Object object;
-extern Viewer viewer;
-extern dodGame game;
-extern Scheduler scheduler;
-extern Parser parser;
-extern Dungeon dungeon;
+extern DOD_CONTEXT_LOCAL OS_Link &oslink;
+extern DOD_CONTEXT_LOCAL Creature &creature;
+extern DOD_CONTEXT_LOCAL Object &object;
+extern DOD_CONTEXT_LOCAL Viewer &viewer;
+extern DOD_CONTEXT_LOCAL dodGame &game;
+extern DOD_CONTEXT_LOCAL Scheduler &scheduler;
+extern DOD_CONTEXT_LOCAL Parser &parser;
+extern DOD_CONTEXT_LOCAL Dungeon &dungeon;
 
 // Constructor
 Player::Player()
@@ -80,7 +80,8 @@ void Player::LoadSounds() {
 // as possible.  It retrieves keyboard input, or commands
 // from the demo data.
 int Player::PLAYER() {
-  dodBYTE *X, *U;
+  const dodBYTE *X;
+  dodBYTE *U;
   int Xup;
 
   // Update Task's next_time
@@ -364,7 +365,7 @@ void Player::HUPDAT() {
       FAINT = -1;
       viewer.clearArea(&viewer.TXTPRI);
       viewer.OLIGHT = viewer.RLIGHT;
-#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_ASYNCIFY__)
+#if defined(DOD_NONBLOCKING)
       // Non-blocking: request faint animation via state machine
       // This shows the heartbeat racing while screen dims
       // Only start if not already in a faint/recover animation
@@ -383,7 +384,7 @@ void Player::HUPDAT() {
         --viewer.UPDATE;
         viewer.draw_game();
         --viewer.RLIGHT;
-        ticks1 = SDL_GetTicks();
+        ticks1 = DOD_GetTicks();
         scheduler.curTime = ticks1;
         do {
           if (scheduler.curTime >= scheduler.TCBLND[0].next_time) {
@@ -391,7 +392,7 @@ void Player::HUPDAT() {
             scheduler.EscCheck();
           }
           DOD_Delay(16); // Reduced ASYNCIFY overhead for mobile browsers
-          scheduler.curTime = SDL_GetTicks();
+          scheduler.curTime = DOD_GetTicks();
         } while (scheduler.curTime < ticks1 + 750);
       } while (viewer.RLIGHT != 248); // not equal to -8
       --viewer.UPDATE;
@@ -401,7 +402,7 @@ void Player::HUPDAT() {
     }
   } else {
     // in a faint
-#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_ASYNCIFY__)
+#if defined(DOD_NONBLOCKING)
     // During non-blocking faint/recover animation, just update HEARTR (already done above)
     // Don't trigger recovery here - let the animation complete first
     dodGame::GameState state = game.getState();
@@ -412,7 +413,7 @@ void Player::HUPDAT() {
 #endif
     if (HEARTR >= 4 && (HEARTR & 128) == 0) {
       // do recover from faint
-#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_ASYNCIFY__)
+#if defined(DOD_NONBLOCKING)
       // Non-blocking: request recover animation via state machine
       game.requestRecoverAnimation();
       return; // Animation will clear FAINT when complete
@@ -422,7 +423,7 @@ void Player::HUPDAT() {
         viewer.draw_game();
         ++viewer.MLIGHT;
         ++viewer.RLIGHT;
-        ticks1 = SDL_GetTicks();
+        ticks1 = DOD_GetTicks();
         scheduler.curTime = ticks1;
         do {
           if (scheduler.curTime >= scheduler.TCBLND[0].next_time) {
@@ -430,7 +431,7 @@ void Player::HUPDAT() {
             scheduler.EscCheck();
           }
           DOD_Delay(16); // Reduced ASYNCIFY overhead for mobile browsers
-          scheduler.curTime = SDL_GetTicks();
+          scheduler.curTime = DOD_GetTicks();
         } while (scheduler.curTime < ticks1 + 750);
       } while (viewer.RLIGHT != viewer.OLIGHT);
       FAINT = 0;
@@ -439,7 +440,7 @@ void Player::HUPDAT() {
 #endif
     }
   }
-#if !defined(__EMSCRIPTEN__) || defined(__EMSCRIPTEN_ASYNCIFY__)
+#if !defined(DOD_NONBLOCKING)
   // For non-ASYNCIFY Emscripten, death is handled by updateFaintAnimation
   if (PLRBLK.P_ATPOW < PLRBLK.P_ATDAM) {
     // Do death
@@ -637,14 +638,14 @@ void Player::PATTK() {
         return false;
       }
     }
-    scheduler.curTime = SDL_GetTicks();
+    scheduler.curTime = DOD_GetTicks();
     return true;
   };
   auto clockOnlyPump = [&]() -> bool {
     if (scheduler.curTime >= scheduler.TCBLND[0].next_time) {
       scheduler.CLOCK();
     }
-    scheduler.curTime = SDL_GetTicks();
+    scheduler.curTime = DOD_GetTicks();
     return true;
   };
   if (!scheduler.WaitForChannel(object.objChannel, waitPump)) {
@@ -704,8 +705,8 @@ void Player::PATTK() {
   optr = creature.CCBLND[cidx].P_CCOBJ;
   while (optr != -1) {
     object.OCBLND[optr].P_OCOWN = 0;
-    object.OCBLND[optr].P_OCROW = creature.CCBLND[cidx].P_CCROW;
-    object.OCBLND[optr].P_OCCOL = creature.CCBLND[cidx].P_CCCOL;
+    object.PlaceObject(optr, creature.CCBLND[cidx].P_CCROW,
+                       creature.CCBLND[cidx].P_CCCOL);
     optr = object.OCBLND[optr].P_OCPTR;
   }
 
@@ -730,12 +731,12 @@ void Player::PATTK() {
 
     // do fade in with message
 
-#if !defined(__EMSCRIPTEN__) || defined(__EMSCRIPTEN_ASYNCIFY__)
+#if !defined(DOD_NONBLOCKING)
     // Pause so player can see scroll (blocking - skip for non-ASYNCIFY)
-    ticks1 = SDL_GetTicks();
+    ticks1 = DOD_GetTicks();
     do {
       DOD_Delay(16); // Reduced ASYNCIFY overhead for mobile browsers
-      ticks2 = SDL_GetTicks();
+      ticks2 = DOD_GetTicks();
     } while (ticks2 < ticks1 + wizDelay);
 #endif
 
@@ -764,7 +765,7 @@ void Player::PATTK() {
                     // Stop buzz
                     Mix_HaltChannel(viewer.fadChannel);
     */
-#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_ASYNCIFY__)
+#if defined(DOD_NONBLOCKING)
     // Non-blocking: request intermission fade, level setup will happen after
     game.requestIntermissionFade(dodGame::POST_FADE_LEVEL3_SETUP);
     return; // Return immediately, rest will happen after fade
@@ -896,16 +897,16 @@ void Player::PCLIMB() {
         temp = viewer.display_mode;
         viewer.display_mode = Viewer::MODE_TITLE;
         viewer.draw_game();
-#if !defined(__EMSCRIPTEN__) || defined(__EMSCRIPTEN_ASYNCIFY__)
+#if !defined(DOD_NONBLOCKING)
         // Blocking pause - skip for non-ASYNCIFY
-        ticks1 = SDL_GetTicks();
+        ticks1 = DOD_GetTicks();
         scheduler.curTime = ticks1;
         do {
           if (scheduler.curTime >= scheduler.TCBLND[0].next_time) {
             scheduler.CLOCK();
           }
           DOD_Delay(16); // Reduced ASYNCIFY overhead for mobile browsers
-          scheduler.curTime = SDL_GetTicks();
+          scheduler.curTime = DOD_GetTicks();
         } while (scheduler.curTime < ticks1 + viewer.prepPause);
 #endif
         viewer.display_mode = temp;
@@ -923,16 +924,16 @@ void Player::PCLIMB() {
         temp = viewer.display_mode;
         viewer.display_mode = Viewer::MODE_TITLE;
         viewer.draw_game();
-#if !defined(__EMSCRIPTEN__) || defined(__EMSCRIPTEN_ASYNCIFY__)
+#if !defined(DOD_NONBLOCKING)
         // Blocking pause - skip for non-ASYNCIFY
-        ticks1 = SDL_GetTicks();
+        ticks1 = DOD_GetTicks();
         scheduler.curTime = ticks1;
         do {
           if (scheduler.curTime >= scheduler.TCBLND[0].next_time) {
             scheduler.CLOCK();
           }
           DOD_Delay(16); // Reduced ASYNCIFY overhead for mobile browsers
-          scheduler.curTime = SDL_GetTicks();
+          scheduler.curTime = DOD_GetTicks();
         } while (scheduler.curTime < ticks1 + viewer.prepPause);
 #endif
         viewer.display_mode = temp;
@@ -975,9 +976,8 @@ void Player::PDROP() {
   }
 
   object.OCBLND[idx].P_OCOWN = 0;
-  object.OCBLND[idx].P_OCROW = PROW;
-  object.OCBLND[idx].P_OCCOL = PCOL;
-  object.OCBLND[idx].P_OCLVL = game.LEVEL;
+  object.PlaceObject(idx, PROW, PCOL);
+  object.SetLevel(idx, game.LEVEL);
 
   POBJWT -= object.OBJWGT[object.OCBLND[idx].obj_type];
   HUPDAT();
@@ -1012,9 +1012,10 @@ void Player::PGET() {
   }
 
   bool match = false;
-  object.OFINDF = 0;
+  RowCol here(PROW, PCOL);
+  idx = -1;
   do {
-    idx = object.OFIND(RowCol(PROW, PCOL));
+    idx = object.NextInCell(here, idx);
     if (idx == -1) {
       parser.CMDERR();
       return;
@@ -1077,7 +1078,7 @@ void Player::PINCAN() {
           if (scheduler.curTime >= scheduler.TCBLND[0].next_time) {
             scheduler.CLOCK();
           }
-          scheduler.curTime = SDL_GetTicks();
+          scheduler.curTime = DOD_GetTicks();
           return true;
         };
         scheduler.WaitForChannel(object.objChannel, ringPump);
@@ -1090,18 +1091,19 @@ void Player::PINCAN() {
           while (SDL_PollEvent(&event))
             ; // clear event buffer
 
-#if !defined(__EMSCRIPTEN__) || defined(__EMSCRIPTEN_ASYNCIFY__)
+#if !defined(DOD_NONBLOCKING)
           // Pause so player can see status line (blocking - skip for non-ASYNCIFY)
-          ticks1 = SDL_GetTicks();
+          viewer.draw_game();
+          ticks1 = DOD_GetTicks();
           do {
             DOD_Delay(16); // Reduced ASYNCIFY overhead for mobile browsers
-            ticks2 = SDL_GetTicks();
+            ticks2 = DOD_GetTicks();
           } while (ticks2 < ticks1 + wizDelay);
 #endif
 
           viewer.clearArea(&viewer.TXTSTS);
           viewer.clearArea(&viewer.TXTPRI);
-#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_ASYNCIFY__)
+#if defined(DOD_NONBLOCKING)
           game.requestVictoryFade();
           return; // hasWon will be set after fade completes
 #else
@@ -1128,7 +1130,7 @@ void Player::PINCAN() {
           if (scheduler.curTime >= scheduler.TCBLND[0].next_time) {
             scheduler.CLOCK();
           }
-          scheduler.curTime = SDL_GetTicks();
+          scheduler.curTime = DOD_GetTicks();
           return true;
         });
 
@@ -1140,18 +1142,19 @@ void Player::PINCAN() {
           while (SDL_PollEvent(&event))
             ; // clear event buffer
 
-#if !defined(__EMSCRIPTEN__) || defined(__EMSCRIPTEN_ASYNCIFY__)
+#if !defined(DOD_NONBLOCKING)
           // Pause so player can see status line (blocking - skip for non-ASYNCIFY)
-          ticks1 = SDL_GetTicks();
+          viewer.draw_game();
+          ticks1 = DOD_GetTicks();
           do {
             DOD_Delay(16); // Reduced ASYNCIFY overhead for mobile browsers
-            ticks2 = SDL_GetTicks();
+            ticks2 = DOD_GetTicks();
           } while (ticks2 < ticks1 + wizDelay);
 #endif
 
           viewer.clearArea(&viewer.TXTSTS);
           viewer.clearArea(&viewer.TXTPRI);
-#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_ASYNCIFY__)
+#if defined(DOD_NONBLOCKING)
           game.requestVictoryFade();
           return; // hasWon will be set after fade completes
 #else
@@ -1183,7 +1186,7 @@ void Player::PMOVE() {
     return;
   } else if (res == 0) {
     // Move Forward
-#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_ASYNCIFY__)
+#if defined(DOD_NONBLOCKING)
     // Non-blocking: request animation via state machine
     game.requestMoveAnimation(0);
     // Animation will complete in future frames
@@ -1191,7 +1194,8 @@ void Player::PMOVE() {
     Uint32 ticks1;
     --viewer.HLFSTP;
     viewer.PUPDAT();
-    ticks1 = SDL_GetTicks();
+    viewer.draw_game(); // Show the half step before blocking
+    ticks1 = DOD_GetTicks();
     scheduler.curTime = ticks1;
     do {
       if (scheduler.curTime >= scheduler.TCBLND[0].next_time) {
@@ -1201,7 +1205,7 @@ void Player::PMOVE() {
         }
       }
       DOD_Delay(8); // Reduced ASYNCIFY overhead for mobile browsers
-      scheduler.curTime = SDL_GetTicks();
+      scheduler.curTime = DOD_GetTicks();
     } while (scheduler.curTime < ticks1 + (moveDelay / 2));
     viewer.HLFSTP = 0;
     PSTEP(0);
@@ -1209,7 +1213,7 @@ void Player::PMOVE() {
     HUPDAT();
     --viewer.UPDATE;
     viewer.draw_game();
-    ticks1 = SDL_GetTicks();
+    ticks1 = DOD_GetTicks();
     scheduler.curTime = ticks1;
     do {
       if (scheduler.curTime >= scheduler.TCBLND[0].next_time) {
@@ -1219,13 +1223,13 @@ void Player::PMOVE() {
         }
       }
       DOD_Delay(8); // Reduced ASYNCIFY overhead for mobile browsers
-      scheduler.curTime = SDL_GetTicks();
+      scheduler.curTime = DOD_GetTicks();
     } while (scheduler.curTime < ticks1 + (moveDelay / 2));
 #endif
     return;
   } else if (A == Parser::DIR_BACK) {
     // Move Back
-#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_ASYNCIFY__)
+#if defined(DOD_NONBLOCKING)
     // Non-blocking: request animation via state machine
     game.requestMoveAnimation(2);
     // Animation will complete in future frames
@@ -1233,7 +1237,8 @@ void Player::PMOVE() {
     Uint32 ticks1;
     --viewer.BAKSTP;
     viewer.PUPDAT();
-    ticks1 = SDL_GetTicks();
+    viewer.draw_game(); // Show the half step before blocking
+    ticks1 = DOD_GetTicks();
     scheduler.curTime = ticks1;
     do {
       if (scheduler.curTime >= scheduler.TCBLND[0].next_time) {
@@ -1243,7 +1248,7 @@ void Player::PMOVE() {
         }
       }
       DOD_Delay(8); // Reduced ASYNCIFY overhead for mobile browsers
-      scheduler.curTime = SDL_GetTicks();
+      scheduler.curTime = DOD_GetTicks();
     } while (scheduler.curTime < ticks1 + (moveDelay / 2));
     viewer.BAKSTP = 0;
     PSTEP(2);
@@ -1251,7 +1256,7 @@ void Player::PMOVE() {
     HUPDAT();
     --viewer.UPDATE;
     viewer.draw_game();
-    ticks1 = SDL_GetTicks();
+    ticks1 = DOD_GetTicks();
     scheduler.curTime = ticks1;
     do {
       if (scheduler.curTime >= scheduler.TCBLND[0].next_time) {
@@ -1261,7 +1266,7 @@ void Player::PMOVE() {
         }
       }
       DOD_Delay(8); // Reduced ASYNCIFY overhead for mobile browsers
-      scheduler.curTime = SDL_GetTicks();
+      scheduler.curTime = DOD_GetTicks();
     } while (scheduler.curTime < ticks1 + (moveDelay / 2));
 #endif
     return;
@@ -1274,7 +1279,7 @@ void Player::PMOVE() {
     }
     PDAM += (POBJWT / 8) + 3;
     HUPDAT();
-#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_ASYNCIFY__)
+#if defined(DOD_NONBLOCKING)
     // Non-blocking: draw_game will be called when animation completes
     if (game.getState() != dodGame::STATE_PLAYING) {
       return;
@@ -1292,7 +1297,7 @@ void Player::PMOVE() {
     }
     PDAM += (POBJWT / 8) + 3;
     HUPDAT();
-#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_ASYNCIFY__)
+#if defined(DOD_NONBLOCKING)
     // Non-blocking: draw_game will be called when animation completes
     if (game.getState() != dodGame::STATE_PLAYING) {
       return;
@@ -1457,7 +1462,7 @@ void Player::PTURN() {
     if (viewer.display_mode == Viewer::MODE_3D) {
       ShowTurn(Parser::DIR_LEFT);
     }
-#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_ASYNCIFY__)
+#if defined(DOD_NONBLOCKING)
     // Non-blocking: draw_game will be called when animation completes
     if (game.getState() != dodGame::STATE_PLAYING) {
       return;
@@ -1473,7 +1478,7 @@ void Player::PTURN() {
     if (viewer.display_mode == Viewer::MODE_3D) {
       ShowTurn(Parser::DIR_RIGHT);
     }
-#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_ASYNCIFY__)
+#if defined(DOD_NONBLOCKING)
     // Non-blocking: draw_game will be called when animation completes
     if (game.getState() != dodGame::STATE_PLAYING) {
       return;
@@ -1489,7 +1494,7 @@ void Player::PTURN() {
     if (viewer.display_mode == Viewer::MODE_3D) {
       ShowTurn(Parser::DIR_AROUND);
     }
-#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_ASYNCIFY__)
+#if defined(DOD_NONBLOCKING)
     // Non-blocking: draw_game will be called when animation completes
     if (game.getState() != dodGame::STATE_PLAYING) {
       return;
@@ -1506,7 +1511,7 @@ void Player::PTURN() {
 
 // Turning Animation
 void Player::ShowTurn(dodBYTE A) {
-#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_ASYNCIFY__)
+#if defined(DOD_NONBLOCKING)
   // Non-blocking: request animation via state machine
   game.requestTurnAnimation(A);
   // Animation will complete in future frames
@@ -1550,9 +1555,9 @@ void Player::ShowTurn(dodBYTE A) {
   turning = true;
   for (ctr = 0; ctr < times; ++ctr) {
     for (x = 0; x < lines; ++x) {
-      ticks1 = SDL_GetTicks();
+      ticks1 = DOD_GetTicks();
       do {
-        scheduler.curTime = SDL_GetTicks();
+        scheduler.curTime = DOD_GetTicks();
         if (scheduler.curTime >= scheduler.TCBLND[0].next_time) {
           scheduler.CLOCK();
           if (game.AUTFLG && game.demoRestart == false) {
@@ -1606,7 +1611,7 @@ void Player::PUSE() {
     if (scheduler.curTime >= scheduler.TCBLND[0].next_time) {
       scheduler.CLOCK();
     }
-    scheduler.curTime = SDL_GetTicks();
+    scheduler.curTime = DOD_GetTicks();
     return true;
   };
 
@@ -1726,6 +1731,7 @@ void Player::PZLOAD() {
     strcat(oslink.gamefile, "game.dod");
   }
 
+  scheduler.waitForSave(oslink.gamefile);
   if ((oslink.fptr = fopen(oslink.gamefile, "r")) == NULL) {
     parser.CMDERR();
     return;
@@ -1766,7 +1772,7 @@ bool Player::PSTEP(dodBYTE dir) {
     if (scheduler.curTime >= scheduler.TCBLND[0].next_time) {
       scheduler.CLOCK();
     }
-    scheduler.curTime = SDL_GetTicks();
+    scheduler.curTime = DOD_GetTicks();
     return true;
   };
   B = dir + PDIR;
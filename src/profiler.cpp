@@ -0,0 +1,148 @@
+/*
+ * profiler.cpp - Per-task instrumentation for the scheduler
+ */
+
+#include "profiler.h"
+#include <cstdio>
+#include <cstring>
+
+// Upper bounds of the lateness buckets, in milliseconds: within one
+// 17 ms tick, then doubling up to the last, open-ended bucket.
+static const Uint32 lateLimits[SchedProfiler::LATE_BUCKETS - 1] = {
+    17, 34, 68, 136, 272};
+
+static const char *const typeNames[SchedProfiler::TASK_TYPES] = {
+    "CLOCK", "PLAYER", "REFRESH", "HRTSLOW", "TORCHBURN", "CRTREGEN",
+    "CRTMOVE"};
+
+void SchedProfiler::Stats::clear() { memset(this, 0, sizeof(*this)); }
+
+SchedProfiler::SchedProfiler() : enabled(false) { reset(); }
+
+void SchedProfiler::reset() {
+  for (int ctr = 0; ctr < TASK_TYPES; ++ctr) {
+    byType[ctr].clear();
+  }
+  for (int ctr = 0; ctr < CREATURE_SLOTS; ++ctr) {
+    byCreature[ctr].clear();
+  }
+  passes = 0;
+  catchupPasses = 0;
+  cappedPasses = 0;
+  maxPassTicks = 0;
+  maxPassTime = 0;
+}
+
+int SchedProfiler::lateBucket(Uint32 lateMs) {
+  int bucket = 0;
+  while (bucket < LATE_BUCKETS - 1 && lateMs >= lateLimits[bucket]) {
+    ++bucket;
+  }
+  return bucket;
+}
+
+// Records one dispatched task.  "data" is the creature index
+// for move tasks; lateMs is how long after its deadline it ran.
+void SchedProfiler::task(int type, int data, Uint64 started, Uint32 lateMs,
+                         bool catchup) {
+  if (type < 0 || type >= TASK_TYPES) {
+    return;
+  }
+  Uint64 elapsed = SDL_GetPerformanceCounter() - started;
+  int bucket = lateBucket(lateMs);
+
+  Stats *rows[2] = {&byType[type], NULL};
+  if (type == TASK_TYPES - 1 && data >= 0 && data < CREATURE_SLOTS) {
+    rows[1] = &byCreature[data];
+  }
+  for (int ctr = 0; ctr < 2 && rows[ctr] != NULL; ++ctr) {
+    Stats &st = *rows[ctr];
+    ++st.calls;
+    if (catchup) {
+      ++st.catchupCalls;
+    }
+    st.totalTicks += elapsed;
+    if (elapsed > st.maxTicks) {
+      st.maxTicks = elapsed;
+    }
+    ++st.late[bucket];
+  }
+}
+
+// Records one call of SCHED() that ran "ticks" fixed steps
+void SchedProfiler::pass(Uint64 started, Uint32 ticks, bool capped) {
+  Uint64 elapsed = SDL_GetPerformanceCounter() - started;
+  ++passes;
+  if (ticks > 1) {
+    ++catchupPasses;
+  }
+  if (capped) {
+    ++cappedPasses;
+  }
+  if (ticks > maxPassTicks) {
+    maxPassTicks = ticks;
+  }
+  if (elapsed > maxPassTime) {
+    maxPassTime = elapsed;
+  }
+}
+
+void SchedProfiler::addRow(std::string &out, const char *name,
+                           const Stats &st, double usPerTick) {
+  char line[160];
+  double total = st.totalTicks * usPerTick;
+  snprintf(line, sizeof(line), "%-10s %9lu %8lu %10.1f %8.2f %8.1f", name,
+           st.calls, st.catchupCalls, total / 1000.0,
+           st.calls ? total / st.calls : 0.0, st.maxTicks * usPerTick);
+  out += line;
+  for (int ctr = 0; ctr < LATE_BUCKETS; ++ctr) {
+    snprintf(line, sizeof(line), " %7lu", st.late[ctr]);
+    out += line;
+  }
+  out += '\n';
+}
+
+// Formats the collected statistics as a plain text table
+std::string SchedProfiler::report() const {
+  double usPerTick = 1000000.0 / SDL_GetPerformanceFrequency();
+
+  std::string out;
+  char line[160];
+  snprintf(line, sizeof(line),
+           "Scheduler profile: %lu passes, %lu catching up, %lu capped, "
+           "at most %u ticks and %.1f us in one pass\n\n",
+           passes, catchupPasses, cappedPasses, maxPassTicks,
+           maxPassTime * usPerTick);
+  out += line;
+
+  const char *header =
+      "%-10s %9s %8s %10s %8s %8s %7s %7s %7s %7s %7s %7s\n";
+  snprintf(line, sizeof(line), header, "task", "calls", "catchup",
+           "total ms", "avg us", "max us", "<17ms", "<34ms", "<68ms",
+           "<136ms", "<272ms", "later");
+  out += line;
+  for (int ctr = 0; ctr < TASK_TYPES; ++ctr) {
+    addRow(out, typeNames[ctr], byType[ctr], usPerTick);
+  }
+
+  out += "\nCreature move tasks:\n";
+  for (int ctr = 0; ctr < CREATURE_SLOTS; ++ctr) {
+    if (byCreature[ctr].calls != 0) {
+      char name[16];
+      snprintf(name, sizeof(name), "CRT %d", ctr);
+      addRow(out, name, byCreature[ctr], usPerTick);
+    }
+  }
+  return out;
+}
+
+bool SchedProfiler::dump(const char *fn) const {
+  FILE *fptr = fopen(fn, "w");
+  if (fptr == NULL) {
+    return false;
+  }
+  std::string text = report();
+  fputs(text.c_str(), fptr);
+  fclose(fptr);
+  return true;
+}
@@ -0,0 +1,65 @@
+/*
+ * profiler.h - Per-task instrumentation for the scheduler
+ *
+ * When enabled (SETOPT PROFILE ON), Scheduler::SCHED() reports every
+ * task it dispatches here.  For each task type, and for each creature's
+ * move task, the profiler keeps call counts, total and worst handler
+ * time from the high-resolution counter, and a histogram of how late
+ * the task ran relative to its deadline.  Calls made while the
+ * scheduler was catching up on a backlog of ticks are counted
+ * separately, to show which handlers are behind frame hitches.
+ */
+
+#ifndef DOD_PROFILER_HEADER
+#define DOD_PROFILER_HEADER
+
+#include "dod.h"
+#include <string>
+
+class SchedProfiler {
+public:
+  SchedProfiler();
+
+  enum {
+    TASK_TYPES = 7,     // Scheduler::TID_CLOCK .. TID_CRTMOVE
+    CREATURE_SLOTS = 32, // Creature::CCBLND
+    LATE_BUCKETS = 6,
+  };
+
+  struct Stats {
+    unsigned long calls;
+    unsigned long catchupCalls; // calls on a catch-up tick
+    Uint64 totalTicks;          // performance counter ticks
+    Uint64 maxTicks;
+    unsigned long late[LATE_BUCKETS];
+
+    void clear();
+  };
+
+  bool enabled;
+
+  void reset();
+  Uint64 start() const { return SDL_GetPerformanceCounter(); }
+  void task(int type, int data, Uint64 started, Uint32 lateMs, bool catchup);
+  void pass(Uint64 started, Uint32 ticks, bool capped);
+
+  bool empty() const { return passes == 0; }
+  std::string report() const;
+  bool dump(const char *fn) const;
+
+private:
+  static int lateBucket(Uint32 lateMs);
+  static void addRow(std::string &out, const char *name, const Stats &st,
+                     double usPerTick);
+
+  Stats byType[TASK_TYPES];
+  Stats byCreature[CREATURE_SLOTS];
+
+  unsigned long passes;
+  unsigned long catchupPasses; // passes that ran more than one tick
+  unsigned long cappedPasses;  // passes stopped by MAX_CATCHUP
+  Uint32 maxPassTicks;
+  Uint64 maxPassTime;
+};
+
+#endif // DOD_PROFILER_HEADER
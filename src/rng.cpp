@@ -12,37 +12,132 @@ is held by Douglas J. Morgan.
 // PC-Port
 // Filename: rng.cpp
 //
-// Implementation of RNG class
+// Tables and jump-ahead for the RNG class (see dod.h)
 
-// Constructor
-RNG::RNG() : carry(0)
+#include "dod.h"
+
+// Eight steps of the original generator from state (SEED[2] << 16),
+// and from (SEED[1] << 8), each leave the feedback bits in the low
+// byte.  The feedback is linear, so the two XOR to the feedback of
+// the whole state.  SEED[0] never reaches a tap within eight steps.
+const dodBYTE RNG::FBHI[256] =
 {
-	SEED[0] = 0;
-	SEED[1] = 0;
-	SEED[2] = 0;
-}
+	0x00, 0x87, 0x0E, 0x89, 0x1C, 0x9B, 0x12, 0x95, 0x38, 0xBF, 0x36, 0xB1, 0x24, 0xA3, 0x2A, 0xAD,
+	0x70, 0xF7, 0x7E, 0xF9, 0x6C, 0xEB, 0x62, 0xE5, 0x48, 0xCF, 0x46, 0xC1, 0x54, 0xD3, 0x5A, 0xDD,
+	0xE0, 0x67, 0xEE, 0x69, 0xFC, 0x7B, 0xF2, 0x75, 0xD8, 0x5F, 0xD6, 0x51, 0xC4, 0x43, 0xCA, 0x4D,
+	0x90, 0x17, 0x9E, 0x19, 0x8C, 0x0B, 0x82, 0x05, 0xA8, 0x2F, 0xA6, 0x21, 0xB4, 0x33, 0xBA, 0x3D,
+	0xC0, 0x47, 0xCE, 0x49, 0xDC, 0x5B, 0xD2, 0x55, 0xF8, 0x7F, 0xF6, 0x71, 0xE4, 0x63, 0xEA, 0x6D,
+	0xB0, 0x37, 0xBE, 0x39, 0xAC, 0x2B, 0xA2, 0x25, 0x88, 0x0F, 0x86, 0x01, 0x94, 0x13, 0x9A, 0x1D,
+	0x20, 0xA7, 0x2E, 0xA9, 0x3C, 0xBB, 0x32, 0xB5, 0x18, 0x9F, 0x16, 0x91, 0x04, 0x83, 0x0A, 0x8D,
+	0x50, 0xD7, 0x5E, 0xD9, 0x4C, 0xCB, 0x42, 0xC5, 0x68, 0xEF, 0x66, 0xE1, 0x74, 0xF3, 0x7A, 0xFD,
+	0x80, 0x07, 0x8E, 0x09, 0x9C, 0x1B, 0x92, 0x15, 0xB8, 0x3F, 0xB6, 0x31, 0xA4, 0x23, 0xAA, 0x2D,
+	0xF0, 0x77, 0xFE, 0x79, 0xEC, 0x6B, 0xE2, 0x65, 0xC8, 0x4F, 0xC6, 0x41, 0xD4, 0x53, 0xDA, 0x5D,
+	0x60, 0xE7, 0x6E, 0xE9, 0x7C, 0xFB, 0x72, 0xF5, 0x58, 0xDF, 0x56, 0xD1, 0x44, 0xC3, 0x4A, 0xCD,
+	0x10, 0x97, 0x1E, 0x99, 0x0C, 0x8B, 0x02, 0x85, 0x28, 0xAF, 0x26, 0xA1, 0x34, 0xB3, 0x3A, 0xBD,
+	0x40, 0xC7, 0x4E, 0xC9, 0x5C, 0xDB, 0x52, 0xD5, 0x78, 0xFF, 0x76, 0xF1, 0x64, 0xE3, 0x6A, 0xED,
+	0x30, 0xB7, 0x3E, 0xB9, 0x2C, 0xAB, 0x22, 0xA5, 0x08, 0x8F, 0x06, 0x81, 0x14, 0x93, 0x1A, 0x9D,
+	0xA0, 0x27, 0xAE, 0x29, 0xBC, 0x3B, 0xB2, 0x35, 0x98, 0x1F, 0x96, 0x11, 0x84, 0x03, 0x8A, 0x0D,
+	0xD0, 0x57, 0xDE, 0x59, 0xCC, 0x4B, 0xC2, 0x45, 0xE8, 0x6F, 0xE6, 0x61, 0xF4, 0x73, 0xFA, 0x7D,
+};
+
+const dodBYTE RNG::FBLO[256] =
+{
+	0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x05, 0x05, 0x06, 0x06, 0x07, 0x07,
+	0x08, 0x08, 0x09, 0x09, 0x0A, 0x0A, 0x0B, 0x0B, 0x0C, 0x0C, 0x0D, 0x0D, 0x0E, 0x0E, 0x0F, 0x0F,
+	0x10, 0x10, 0x11, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x15, 0x15, 0x16, 0x16, 0x17, 0x17,
+	0x18, 0x18, 0x19, 0x19, 0x1A, 0x1A, 0x1B, 0x1B, 0x1C, 0x1C, 0x1D, 0x1D, 0x1E, 0x1E, 0x1F, 0x1F,
+	0x21, 0x21, 0x20, 0x20, 0x23, 0x23, 0x22, 0x22, 0x25, 0x25, 0x24, 0x24, 0x27, 0x27, 0x26, 0x26,
+	0x29, 0x29, 0x28, 0x28, 0x2B, 0x2B, 0x2A, 0x2A, 0x2D, 0x2D, 0x2C, 0x2C, 0x2F, 0x2F, 0x2E, 0x2E,
+	0x31, 0x31, 0x30, 0x30, 0x33, 0x33, 0x32, 0x32, 0x35, 0x35, 0x34, 0x34, 0x37, 0x37, 0x36, 0x36,
+	0x39, 0x39, 0x38, 0x38, 0x3B, 0x3B, 0x3A, 0x3A, 0x3D, 0x3D, 0x3C, 0x3C, 0x3F, 0x3F, 0x3E, 0x3E,
+	0x43, 0x43, 0x42, 0x42, 0x41, 0x41, 0x40, 0x40, 0x47, 0x47, 0x46, 0x46, 0x45, 0x45, 0x44, 0x44,
+	0x4B, 0x4B, 0x4A, 0x4A, 0x49, 0x49, 0x48, 0x48, 0x4F, 0x4F, 0x4E, 0x4E, 0x4D, 0x4D, 0x4C, 0x4C,
+	0x53, 0x53, 0x52, 0x52, 0x51, 0x51, 0x50, 0x50, 0x57, 0x57, 0x56, 0x56, 0x55, 0x55, 0x54, 0x54,
+	0x5B, 0x5B, 0x5A, 0x5A, 0x59, 0x59, 0x58, 0x58, 0x5F, 0x5F, 0x5E, 0x5E, 0x5D, 0x5D, 0x5C, 0x5C,
+	0x62, 0x62, 0x63, 0x63, 0x60, 0x60, 0x61, 0x61, 0x66, 0x66, 0x67, 0x67, 0x64, 0x64, 0x65, 0x65,
+	0x6A, 0x6A, 0x6B, 0x6B, 0x68, 0x68, 0x69, 0x69, 0x6E, 0x6E, 0x6F, 0x6F, 0x6C, 0x6C, 0x6D, 0x6D,
+	0x72, 0x72, 0x73, 0x73, 0x70, 0x70, 0x71, 0x71, 0x76, 0x76, 0x77, 0x77, 0x74, 0x74, 0x75, 0x75,
+	0x7A, 0x7A, 0x7B, 0x7B, 0x78, 0x78, 0x79, 0x79, 0x7E, 0x7E, 0x7F, 0x7F, 0x7C, 0x7C, 0x7D, 0x7D,
+};
 
-// Returns the next random number based on seeds
-// and updates the seeds accordingly.
-dodBYTE RNG::RANDOM()
+namespace
 {
-	int x, y;
-	dodBYTE a, b;
-	carry = 0;
-	for (x = 8; x != 0; --x)
+	const int STATE_BITS = 24;
+	const int JUMP_POWERS = sizeof(unsigned long) * 8;
+
+	// The state SEED[2] << 16 | SEED[1] << 8 | SEED[0]
+	Uint32 pack(const dodBYTE * SEED)
+	{
+		return ((Uint32) SEED[2] << 16) | ((Uint32) SEED[1] << 8) | SEED[0];
+	}
+
+	// One RANDOM() call on a packed state
+	Uint32 step(Uint32 s)
+	{
+		RNG r;
+		r.setSEED((dodBYTE) s, (dodBYTE) (s >> 8), (dodBYTE) (s >> 16));
+		r.RANDOM();
+		return pack(r.SEED);
+	}
+
+	// A linear map on packed states, as the image of each state bit
+	struct Jump
 	{
-		b = 0;
-		a = (SEED[2] & 0xE1);
-		for (y = 8; y != 0; --y)
+		Uint32 col[STATE_BITS];
+
+		Uint32 apply(Uint32 s) const
 		{
-			a = lsl(a);
-			if (carry != 0)
-				++b;
+			Uint32 out = 0;
+			for (int bit = 0; bit < STATE_BITS; ++bit)
+			{
+				if (s & (1UL << bit))
+					out ^= col[bit];
+			}
+			return out;
 		}
-		b = lsr(b);
-		SEED[0] = rol(SEED[0]);
-		SEED[1] = rol(SEED[1]);
-		SEED[2] = rol(SEED[2]);
+	};
+
+	// power[k] advances a state by 2^k RANDOM() calls
+	struct JumpTable
+	{
+		Jump power[JUMP_POWERS];
+
+		JumpTable()
+		{
+			int bit, k;
+			for (bit = 0; bit < STATE_BITS; ++bit)
+			{
+				power[0].col[bit] = step(1UL << bit);
+			}
+			for (k = 1; k < JUMP_POWERS; ++k)
+			{
+				for (bit = 0; bit < STATE_BITS; ++bit)
+				{
+					power[k].col[bit] = power[k - 1].apply(power[k - 1].col[bit]);
+				}
+			}
+		}
+	};
+}
+
+// Jumps over all but the last call, then makes that one so carry is
+// left as RANDOM() would leave it.
+void RNG::skip(unsigned long n)
+{
+	static const JumpTable jumps;
+	Uint32 s;
+	int k;
+
+	if (n == 0)
+		return;
+
+	--n;
+	s = pack(SEED);
+	for (k = 0; n != 0; ++k, n >>= 1)
+	{
+		if (n & 1)
+			s = jumps.power[k].apply(s);
 	}
-	return SEED[0];
+	setSEED((dodBYTE) s, (dodBYTE) (s >> 8), (dodBYTE) (s >> 16));
+	RANDOM();
 }
@@ -0,0 +1,212 @@
+/*
+ * savefile.cpp - Binary saved game format
+ */
+
+#include "savefile.h"
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+
+static const unsigned char saveMagic[4] = {'D', 'o', 'D', 's'};
+
+static void putLE(unsigned char *p, Uint32 v, int bytes) {
+  for (int ctr = 0; ctr < bytes; ++ctr) {
+    p[ctr] = (unsigned char)(v >> (8 * ctr));
+  }
+}
+
+static Uint32 getLE(const unsigned char *p, int bytes) {
+  Uint32 v = 0;
+  for (int ctr = 0; ctr < bytes; ++ctr) {
+    v |= (Uint32)p[ctr] << (8 * ctr);
+  }
+  return v;
+}
+
+bool SaveFile::isBinary(const unsigned char *data, size_t len) {
+  return len >= HEADER_SIZE && memcmp(data, saveMagic, 4) == 0;
+}
+
+namespace {
+struct CrcTable {
+  Uint32 entry[256];
+  CrcTable() {
+    for (Uint32 n = 0; n < 256; ++n) {
+      Uint32 c = n;
+      for (int k = 0; k < 8; ++k) {
+        c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+      }
+      entry[n] = c;
+    }
+  }
+};
+} // namespace
+
+// Standard CRC-32 (the zlib/PNG polynomial)
+Uint32 SaveFile::crc32(const unsigned char *data, size_t len) {
+  static const CrcTable table;
+
+  Uint32 crc = 0xFFFFFFFFu;
+  for (size_t ctr = 0; ctr < len; ++ctr) {
+    crc = table.entry[(crc ^ data[ctr]) & 0xFF] ^ (crc >> 8);
+  }
+  return crc ^ 0xFFFFFFFFu;
+}
+
+/*********************************************************************
+  SaveWriter
+*********************************************************************/
+
+SaveWriter::SaveWriter() {
+  payload.reserve(8192);
+  sections.reserve(16);
+}
+
+void SaveWriter::clear() {
+  payload.clear();
+  sections.clear();
+}
+
+void SaveWriter::begin(Uint32 id) {
+  Section sec;
+  sec.id = id;
+  sec.start = (Uint32)payload.size();
+  sections.push_back(sec);
+}
+
+void SaveWriter::put(Uint32 v, int bytes) {
+  size_t at = payload.size();
+  payload.resize(at + bytes);
+  putLE(&payload[at], v, bytes);
+}
+
+// Lays out header, section table and payload in "out"
+void SaveWriter::finish(std::vector<unsigned char> &out) const {
+  size_t count = sections.size();
+  size_t base = SaveFile::HEADER_SIZE + count * SaveFile::ENTRY_SIZE;
+
+  out.assign(base + payload.size(), 0);
+  memcpy(&out[0], saveMagic, 4);
+  putLE(&out[4], SaveFile::VERSION, 2);
+  putLE(&out[6], (Uint32)count, 2);
+
+  for (size_t ctr = 0; ctr < count; ++ctr) {
+    Uint32 stop = (ctr + 1 < count) ? sections[ctr + 1].start
+                                    : (Uint32)payload.size();
+    unsigned char *entry =
+        &out[SaveFile::HEADER_SIZE + ctr * SaveFile::ENTRY_SIZE];
+    putLE(entry, sections[ctr].id, 4);
+    putLE(entry + 4, (Uint32)base + sections[ctr].start, 4);
+    putLE(entry + 8, stop - sections[ctr].start, 4);
+  }
+  if (!payload.empty()) {
+    memcpy(&out[base], &payload[0], payload.size());
+  }
+
+  putLE(&out[8],
+        SaveFile::crc32(&out[SaveFile::HEADER_SIZE],
+                        out.size() - SaveFile::HEADER_SIZE),
+        4);
+}
+
+/*********************************************************************
+  SaveReader
+*********************************************************************/
+
+// Checks magic, version, checksum and section table
+bool SaveReader::open(const unsigned char *d, size_t len) {
+  data = NULL;
+  if (!SaveFile::isBinary(d, len)) {
+    return false;
+  }
+  if (getLE(d + 4, 2) > SaveFile::VERSION) {
+    return false; // written by a newer build
+  }
+  if (getLE(d + 8, 4) !=
+      SaveFile::crc32(d + SaveFile::HEADER_SIZE, len - SaveFile::HEADER_SIZE)) {
+    return false;
+  }
+
+  Uint32 count = getLE(d + 6, 2);
+  if (len < SaveFile::HEADER_SIZE + (size_t)count * SaveFile::ENTRY_SIZE) {
+    return false;
+  }
+  for (Uint32 ctr = 0; ctr < count; ++ctr) {
+    const unsigned char *entry =
+        d + SaveFile::HEADER_SIZE + ctr * SaveFile::ENTRY_SIZE;
+    Uint32 offset = getLE(entry + 4, 4);
+    Uint32 length = getLE(entry + 8, 4);
+    if (offset > len || length > len - offset) {
+      return false;
+    }
+  }
+
+  data = d;
+  pos = end = 0;
+  return true;
+}
+
+bool SaveReader::section(Uint32 id) {
+  pos = end = 0;
+  if (data == NULL) {
+    return false;
+  }
+  Uint32 count = getLE(data + 6, 2);
+  for (Uint32 ctr = 0; ctr < count; ++ctr) {
+    const unsigned char *entry =
+        data + SaveFile::HEADER_SIZE + ctr * SaveFile::ENTRY_SIZE;
+    if (getLE(entry, 4) == id) {
+      pos = getLE(entry + 4, 4);
+      end = pos + getLE(entry + 8, 4);
+      return true;
+    }
+  }
+  return false;
+}
+
+// Fields past the end of a section keep their current value
+Uint32 SaveReader::get(int bytes, Uint32 old) {
+  if (end - pos < (size_t)bytes) {
+    pos = end;
+    return old;
+  }
+  Uint32 v = getLE(data + pos, bytes);
+  pos += bytes;
+  return v;
+}
+
+/*********************************************************************
+  LegacySaveReader
+*********************************************************************/
+
+bool LegacySaveReader::more() {
+  while (text < stop && isspace((unsigned char)*text)) {
+    ++text;
+  }
+  return text < stop;
+}
+
+// Reads the next whitespace-separated token, as the old
+// "fin >> instr; sscanf(instr, "%d", &in)" loop did
+bool LegacySaveReader::next(int &in) {
+  if (!more()) {
+    return false;
+  }
+  char token[64];
+  size_t len = 0;
+  while (text < stop && !isspace((unsigned char)*text)) {
+    if (len < sizeof(token) - 1) {
+      token[len++] = *text;
+    }
+    ++text;
+  }
+  token[len] = '\0';
+
+  char *tail;
+  long v = strtol(token, &tail, 10);
+  if (tail == token) {
+    return false;
+  }
+  in = (int)v;
+  return true;
+}
@@ -0,0 +1,131 @@
+/*
+ * savefile.h - Binary saved game format
+ *
+ * A saved game is one block of bytes, written and read in a single
+ * call.  All integers are little-endian:
+ *
+ *   header    "DoDs" magic, u16 format version, u16 section count,
+ *             u32 CRC-32 of everything after the header
+ *   table     for each section: u32 id, u32 offset, u32 length
+ *   sections  the section payloads, back to back
+ *
+ * Sections hold the maze, player, RNG, creatures, objects, viewer and
+ * gameplay mods.  Inside a section each field is stored at its own
+ * width (bytes as u8, shorts as u16, ints as i32, flags as u8), in the
+ * order the section's io function in sched.cpp visits them.  Readers
+ * skip sections they do not know, and treat a section that ends early
+ * as holding only its leading fields, so fields can be appended to a
+ * section without bumping the version.
+ *
+ * Rewind snapshots (snapshot.h) use the same format with one more
+ * section, the scheduler's task table, which files never contain.
+ *
+ * LegacySaveReader parses the old whitespace-separated text .dod
+ * files through the same io functions, so old saves still load.
+ */
+
+#ifndef DOD_SAVEFILE_HEADER
+#define DOD_SAVEFILE_HEADER
+
+#include "dod.h"
+#include <vector>
+
+namespace SaveFile {
+enum {
+  VERSION = 1,
+  HEADER_SIZE = 12,
+  ENTRY_SIZE = 12,
+};
+
+// Section ids, as four characters in file order
+#define DOD_SECTION_ID(a, b, c, d)                                           \
+  ((Uint32)(a) | ((Uint32)(b) << 8) | ((Uint32)(c) << 16) |                  \
+   ((Uint32)(d) << 24))
+
+const Uint32 SEC_MAZE = DOD_SECTION_ID('M', 'A', 'Z', 'E');
+const Uint32 SEC_PLAYER = DOD_SECTION_ID('P', 'L', 'Y', 'R');
+const Uint32 SEC_RNG = DOD_SECTION_ID('R', 'N', 'G', ' ');
+const Uint32 SEC_CREATURES = DOD_SECTION_ID('C', 'R', 'T', 'S');
+const Uint32 SEC_OBJECTS = DOD_SECTION_ID('O', 'B', 'J', 'S');
+const Uint32 SEC_VIEWER = DOD_SECTION_ID('V', 'I', 'E', 'W');
+const Uint32 SEC_MODS = DOD_SECTION_ID('M', 'O', 'D', 'S');
+const Uint32 SEC_TASKS = DOD_SECTION_ID('T', 'A', 'S', 'K');
+
+// True if the data starts with the binary format's magic
+bool isBinary(const unsigned char *data, size_t len);
+
+Uint32 crc32(const unsigned char *data, size_t len);
+} // namespace SaveFile
+
+// Builds a saved game in memory.  A writer that is cleared and
+// reused does not allocate once it has grown to a full save.
+class SaveWriter {
+public:
+  SaveWriter();
+
+  void clear();
+  void begin(Uint32 id); // starts the next section
+  void finish(std::vector<unsigned char> &out) const;
+
+  void io(dodBYTE &v) { put(v, 1); }
+  void io(dodSHORT &v) { put(v, 2); }
+  void io(int &v) { put((Uint32)v, 4); }
+  void io(bool &v) { put(v ? 1 : 0, 1); }
+
+private:
+  struct Section {
+    Uint32 id;
+    Uint32 start;
+  };
+
+  void put(Uint32 v, int bytes);
+
+  std::vector<unsigned char> payload;
+  std::vector<Section> sections;
+};
+
+// Reads a saved game that has passed open()
+class SaveReader {
+public:
+  SaveReader() : data(NULL), pos(0), end(0) {}
+
+  bool open(const unsigned char *d, size_t len);
+  bool section(Uint32 id); // false if the file has no such section
+
+  void io(dodBYTE &v) { v = (dodBYTE)get(1, v); }
+  void io(dodSHORT &v) { v = (dodSHORT)get(2, v); }
+  void io(int &v) { v = (int)get(4, (Uint32)v); }
+  void io(bool &v) { v = get(1, v ? 1 : 0) != 0; }
+
+private:
+  Uint32 get(int bytes, Uint32 old);
+
+  const unsigned char *data;
+  size_t pos;
+  size_t end;
+};
+
+// Reads the original text format: one decimal number per line.
+// A value that does not parse leaves the field unchanged.
+class LegacySaveReader {
+public:
+  LegacySaveReader(const char *d, size_t len)
+      : text(d), stop(d + len) {}
+
+  bool more(); // is there another value?
+
+  template <class T> void io(T &v) {
+    int in;
+    if (next(in)) {
+      v = (T)in;
+    }
+  }
+
+private:
+  bool next(int &in);
+
+  const char *text;
+  const char *stop;
+};
+
+#endif // DOD_SAVEFILE_HEADER
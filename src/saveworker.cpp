@@ -0,0 +1,189 @@
+/*
+ * saveworker.cpp - Saves games off the game thread
+ */
+
+#include "saveworker.h"
+#include "oslink.h"
+
+extern DOD_CONTEXT_LOCAL OS_Link &oslink;
+
+#ifdef __EMSCRIPTEN__
+// Runs from the browser's event loop, outside any frame
+static void syncSaves(void *) { oslink.syncSavedGames(); }
+#endif
+
+SaveWorker::SaveWorker()
+#ifdef DOD_SAVE_THREAD
+    : thread(NULL), lock(NULL), wake(NULL), done(NULL), quit(false)
+#endif
+{
+}
+
+SaveWorker::~SaveWorker() { shutdown(); }
+
+void SaveWorker::submit(std::vector<unsigned char> &data, const char *fn) {
+#ifdef DOD_SAVE_THREAD
+  if (thread == NULL) {
+    lock = SDL_CreateMutex();
+    wake = SDL_CreateCond();
+    done = SDL_CreateCond();
+    thread = SDL_CreateThread(run, "DoD save", this);
+  }
+  if (thread != NULL) {
+    SDL_LockMutex(lock);
+    jobs.push_back(Job());
+    jobs.back().data.swap(data);
+    jobs.back().fn = fn;
+    SDL_CondSignal(wake);
+    SDL_UnlockMutex(lock);
+    return;
+  }
+#endif
+  // No worker: written on the next poll()
+  jobs.push_back(Job());
+  jobs.back().data.swap(data);
+  jobs.back().fn = fn;
+}
+
+bool SaveWorker::poll(bool &ok) {
+#ifdef DOD_SAVE_THREAD
+  if (thread != NULL) {
+    SDL_LockMutex(lock);
+    bool done = !results.empty();
+    if (done) {
+      ok = results.front();
+      results.pop_front();
+    }
+    SDL_UnlockMutex(lock);
+    return done;
+  }
+#endif
+  runPending();
+  if (results.empty()) {
+    return false;
+  }
+  ok = results.front();
+  results.pop_front();
+  return true;
+}
+
+void SaveWorker::wait(const char *fn) {
+#ifdef DOD_SAVE_THREAD
+  if (thread != NULL) {
+    SDL_LockMutex(lock);
+    while (pending(fn)) {
+      SDL_CondWait(done, lock);
+    }
+    SDL_UnlockMutex(lock);
+    return;
+  }
+#endif
+  runPending();
+}
+
+void SaveWorker::shutdown() {
+#ifdef DOD_SAVE_THREAD
+  if (thread != NULL) {
+    SDL_LockMutex(lock);
+    quit = true;
+    SDL_CondSignal(wake);
+    SDL_UnlockMutex(lock);
+    SDL_WaitThread(thread, NULL);
+    thread = NULL;
+    quit = false;
+  }
+  if (lock != NULL) {
+    SDL_DestroyCond(done);
+    SDL_DestroyCond(wake);
+    SDL_DestroyMutex(lock);
+    done = NULL;
+    wake = NULL;
+    lock = NULL;
+  }
+#endif
+  runPending();
+}
+
+// Writes the jobs queued without a worker thread
+void SaveWorker::runPending() {
+  while (!jobs.empty()) {
+    results.push_back(write(jobs.front()));
+    jobs.pop_front();
+  }
+}
+
+// Writes one saved game with a single write, to a temporary
+// file that then replaces the old save
+bool SaveWorker::write(const Job &job) {
+  std::string tmp = job.fn + ".tmp";
+  FILE *fptr = fopen(tmp.c_str(), "wb");
+  if (fptr == NULL) {
+    return false;
+  }
+  bool ok = job.data.empty() ||
+            fwrite(&job.data[0], 1, job.data.size(), fptr) == job.data.size();
+  ok = (fclose(fptr) == 0) && ok;
+  if (ok && rename(tmp.c_str(), job.fn.c_str()) != 0) {
+    // Windows will not rename over an existing file
+    remove(job.fn.c_str());
+    ok = (rename(tmp.c_str(), job.fn.c_str()) == 0);
+  }
+  if (!ok) {
+    remove(tmp.c_str());
+  }
+
+#ifdef __EMSCRIPTEN__
+  // Sync saved games to persistent storage (IndexedDB)
+  if (ok) {
+    emscripten_async_call(syncSaves, NULL, 0);
+  }
+#endif
+  return ok;
+}
+
+#ifdef DOD_SAVE_THREAD
+// True if a job for "fn" is queued or being written; called
+// with the lock held
+bool SaveWorker::pending(const char *fn) const {
+  if (writing == fn) {
+    return true;
+  }
+  for (size_t idx = 0; idx < jobs.size(); ++idx) {
+    if (jobs[idx].fn == fn) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Worker thread: writes jobs in order until shutdown() and
+// the queue is empty
+int SaveWorker::run(void *self) {
+  SaveWorker *worker = (SaveWorker *)self;
+
+  SDL_LockMutex(worker->lock);
+  for (;;) {
+    while (worker->jobs.empty() && !worker->quit) {
+      SDL_CondWait(worker->wake, worker->lock);
+    }
+    if (worker->jobs.empty()) {
+      break;
+    }
+    Job job;
+    job.data.swap(worker->jobs.front().data);
+    job.fn.swap(worker->jobs.front().fn);
+    worker->jobs.pop_front();
+    worker->writing = job.fn;
+    SDL_UnlockMutex(worker->lock);
+
+    bool ok = write(job);
+
+    SDL_LockMutex(worker->lock);
+    worker->writing.clear();
+    worker->results.push_back(ok);
+    SDL_CondBroadcast(worker->done);
+  }
+  SDL_UnlockMutex(worker->lock);
+  return 0;
+}
+#endif
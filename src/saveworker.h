@@ -0,0 +1,72 @@
+/*
+ * saveworker.h - Saves games off the game thread
+ *
+ * Scheduler::SAVE() serializes the game into a buffer, which is a
+ * consistent copy taken between tasks, and submits it here.  Writing
+ * the file and syncing it to persistent storage happen on a worker
+ * thread on desktop.  Web builds have no threads, so the write and
+ * the IndexedDB sync run on the next frame instead, and the sync is
+ * posted to the browser's event loop.  The game thread polls for
+ * finished saves and reports them in the text area.
+ *
+ * Each save is written to a ".tmp" file beside the target and then
+ * renamed over it, so a failed or interrupted write leaves the old
+ * save intact.  Anything that reads or deletes a save file first
+ * waits for writes queued to that path.
+ */
+
+#ifndef DOD_SAVEWORKER_HEADER
+#define DOD_SAVEWORKER_HEADER
+
+#include "dod.h"
+#include <deque>
+#include <vector>
+
+#if !defined(__EMSCRIPTEN__) && !defined(DOD_HEADLESS)
+#define DOD_SAVE_THREAD
+#endif
+
+class SaveWorker {
+public:
+  SaveWorker();
+  ~SaveWorker();
+
+  // Takes the contents of "data", leaving it empty
+  void submit(std::vector<unsigned char> &data, const char *fn);
+
+  // True if a save finished since the last call; "ok" is false
+  // if it could not be written
+  bool poll(bool &ok);
+
+  // Waits until no save to "fn" is queued or being written
+  void wait(const char *fn);
+
+  // Finishes all pending saves before returning
+  void shutdown();
+
+private:
+  struct Job {
+    std::vector<unsigned char> data;
+    std::string fn;
+  };
+
+  static bool write(const Job &job);
+  void runPending();
+
+  std::deque<Job> jobs;
+  std::deque<bool> results;
+
+#ifdef DOD_SAVE_THREAD
+  static int run(void *self);
+  bool pending(const char *fn) const;
+
+  SDL_Thread *thread;
+  SDL_mutex *lock;
+  SDL_cond *wake;
+  SDL_cond *done; // signalled after each job is written
+  std::string writing; // file of the job being written, if any
+  bool quit;
+#endif
+};
+
+#endif // DOD_SAVEWORKER_HEADER
@@ -14,8 +14,11 @@ is held by Douglas J. Morgan.
 //
 // Implementation of the Scheduler class
 
+#ifndef DOD_HEADLESS
 #include <SDL2/SDL_mutex.h>
-#include <fstream>
+#endif
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 
 
@@ -24,23 +27,25 @@ using namespace std;
 #include "creature.h"
 #include "dodgame.h"
 #include "dungeon.h"
+#include "enhanced.h"
 #include "object.h"
 #include "oslink.h"
 #include "parser.h"
 #include "player.h"
+#include "savefile.h"
 #include "sched.h"
 #include "viewer.h"
 
 
-extern Object object;
-extern RNG rng;
-extern Dungeon dungeon;
-extern dodGame game;
-extern Parser parser;
-extern Creature creature;
-extern Player player;
-extern Viewer viewer;
-extern OS_Link oslink;
+extern DOD_CONTEXT_LOCAL Object &object;
+extern DOD_CONTEXT_LOCAL RNG &rng;
+extern DOD_CONTEXT_LOCAL Dungeon &dungeon;
+extern DOD_CONTEXT_LOCAL dodGame &game;
+extern DOD_CONTEXT_LOCAL Parser &parser;
+extern DOD_CONTEXT_LOCAL Creature &creature;
+extern DOD_CONTEXT_LOCAL Player &player;
+extern DOD_CONTEXT_LOCAL Viewer &viewer;
+extern DOD_CONTEXT_LOCAL OS_Link &oslink;
 
 Scheduler *Scheduler::instance = nullptr;
 
@@ -121,7 +126,11 @@ void Scheduler::OnChannelFinished(int channel) {
 }
 
 // Constructor
-Scheduler::Scheduler() { Reset(); }
+Scheduler::Scheduler() {
+  SetDodStr(DERR, "DISK ERROR");
+  SetDodStr(DSAVE, "GAME SAVED");
+  Reset();
+}
 
 void Scheduler::Reset() {
   curTime = 0;
@@ -139,6 +148,7 @@ void Scheduler::Reset() {
 
   for (int ctr = 0; ctr < 38; ++ctr)
     TCBLND[ctr].clear();
+  queueDirty = true;
 }
 
 // Public Interface
@@ -157,6 +167,7 @@ void Scheduler::SYSTCB() {
   }
 
   TCBPTR = 0;
+  queueDirty = true;
 
   TCBLND[0].type = TID_CLOCK;
   TCBLND[0].frequency = 17; // One JIFFY
@@ -187,15 +198,19 @@ void Scheduler::SYSTCB() {
 // code, but it has been entirely replaced with a simpler
 // algorithm that works better on modern platforms.
 //
-// It uses milliseconds instead of JIFFYs.  And it does
-// not have any queues, but a simple array of Task objects.
+// It uses milliseconds instead of JIFFYs.  Tasks live in a
+// simple array of Task objects, but the due ones are found
+// through a min-heap keyed on next_time, so a tick only
+// touches tasks whose deadline has passed.  Due tasks are
+// still dispatched in TCB index order, exactly as the old
+// full-table scan did.
 //
 // Delta-time compensation: accumulates real time and processes
 // fixed tick steps to maintain consistent game timing regardless
 // of frame rate variations (especially important for browser/mobile).
 bool Scheduler::SCHED() {
   // Calculate delta time since last frame
-  Uint32 now = SDL_GetTicks();
+  Uint32 now = DOD_GetTicks();
   if (lastFrameTime == 0) {
     lastFrameTime = now; // First frame initialization
   }
@@ -211,60 +226,109 @@ bool Scheduler::SCHED() {
   // Accumulate time
   accumulator += dt;
 
+  pollSaves();
+
   // Process fixed-step ticks with catch-up limit
   Uint32 ticksProcessed = 0;
+  Uint64 passStart = profiler.enabled ? profiler.start() : 0;
+  Tracer &tracer = oslink.tracer;
   while (accumulator >= TICK_STEP && ticksProcessed < MAX_CATCHUP) {
+    TraceScope tick(tracer, "SCHED tick", "sched");
+
     // Update current time for this tick
     curTime = now - (accumulator - TICK_STEP);
 
-    // Process all tasks for this tick
-    for (schedCtr = 0; schedCtr < TCBPTR; ++schedCtr) {
-      if (curTime >= TCBLND[schedCtr].next_time) {
-        int result = 0;
-        switch (TCBLND[schedCtr].type) {
-        case TID_CLOCK:
-          CLOCK();
-          break;
-        case TID_PLAYER:
-          result = player.PLAYER();
-          break;
-        case TID_REFRESH_DISP:
-          result = viewer.LUKNEW();
-          break;
-        case TID_HRTSLOW:
-          result = player.HSLOW();
-          // HSLOW can trigger faint/recovery animation - exit scheduler immediately
-          // to prevent creature attacks during faint animation
-          if (game.getState() == dodGame::STATE_FAINT_ANIMATION ||
-              game.getState() == dodGame::STATE_RECOVER_ANIMATION) {
-            return false; // Exit scheduler, animation will run next frame
+    // Snapshot for REWIND, between ticks while state is consistent
+    if (!game.AUTFLG && snapshots.due(curTime)) {
+      TraceScope snap(tracer, "snapshot", "sched");
+      takeSnapshot();
+    }
+
+    // Gather the tasks that are due on this tick
+    if (queueDirty) {
+      rebuildQueue(-1);
+    } else {
+      collectDueTasks();
+    }
+
+    // Process due tasks for this tick.  The exit checks below
+    // run at least once per tick, as they did with the old scan.
+    size_t dueCtr = 0;
+    bool checked = false;
+    while (dueCtr < dueTasks.size() || (!checked && TCBPTR > 0)) {
+      checked = true;
+      if (dueCtr < dueTasks.size()) {
+        schedCtr = dueTasks[dueCtr++];
+        if (curTime >= TCBLND[schedCtr].next_time) {
+          int result = 0;
+          int taskType = TCBLND[schedCtr].type;
+          int taskData = TCBLND[schedCtr].data;
+          Uint32 lateMs = curTime - TCBLND[schedCtr].next_time;
+          Uint64 taskStart = profiler.enabled ? profiler.start() : 0;
+          TraceScope traceTask(tracer, taskTraceName(taskType), "task",
+                               taskType == TID_CRTMOVE ? taskData : -1);
+          switch (TCBLND[schedCtr].type) {
+          case TID_CLOCK:
+            CLOCK();
+            break;
+          case TID_PLAYER:
+            result = player.PLAYER();
+            break;
+          case TID_REFRESH_DISP:
+            result = viewer.LUKNEW();
+            break;
+          case TID_HRTSLOW:
+            result = player.HSLOW();
+            // HSLOW can trigger faint/recovery animation - exit scheduler
+            // immediately to prevent creature attacks during faint animation
+            if (game.getState() == dodGame::STATE_FAINT_ANIMATION ||
+                game.getState() == dodGame::STATE_RECOVER_ANIMATION) {
+              queueDirty = true;
+              return false; // Exit scheduler, animation will run next frame
+            }
+            break;
+          case TID_TORCHBURN:
+            result = player.BURNER();
+            break;
+          case TID_CRTREGEN:
+            result = creature.CREGEN();
+            break;
+          case TID_CRTMOVE:
+            result = creature.CMOVE(schedCtr, TCBLND[schedCtr].data);
+            break;
+          default:
+            break;
+          }
+          (void)result; // Suppress unused warning
+          if (profiler.enabled) {
+            profiler.task(taskType, taskData, taskStart, lateMs,
+                          ticksProcessed > 0);
           }
-          break;
-        case TID_TORCHBURN:
-          result = player.BURNER();
-          break;
-        case TID_CRTREGEN:
-          result = creature.CREGEN();
-          break;
-        case TID_CRTMOVE:
-          result = creature.CMOVE(schedCtr, TCBLND[schedCtr].data);
-          break;
-        default:
-          break;
         }
-        (void)result; // Suppress unused warning
+
+        // A task that rebuilt the TCB table (new level, creature
+        // birth) invalidates the queue; carry on with the later
+        // slots that are now due, like the old scan would have.
+        if (queueDirty) {
+          rebuildQueue(schedCtr);
+          dueCtr = 0;
+        } else {
+          queueTask(schedCtr);
+        }
       }
 
       // Check if faint/recovery animation started - stop processing tasks
       // This prevents creatures from attacking during faint animations
       if (game.getState() == dodGame::STATE_FAINT_ANIMATION ||
           game.getState() == dodGame::STATE_RECOVER_ANIMATION) {
+        queueDirty = true;
         return false; // Animation running, don't process more tasks
       }
 
       // Check for save/load
       if (ZFLAG != 0) {
         if (ZFLAG == 0xFF) {
+          queueDirty = true;
           return true; // Load game abandons current game
         } else {
           SAVE();
@@ -272,13 +336,27 @@ bool Scheduler::SCHED() {
         }
       }
 
+      // Check for rewind.  The task table is replaced, so
+      // the rest of this pass is abandoned.
+      if (rewindSteps != 0) {
+        int steps = rewindSteps;
+        rewindSteps = 0;
+        if (restoreSnapshot(steps)) {
+          queueDirty = true;
+          return false;
+        }
+        parser.CMDERR();
+      }
+
       // Check for death
       if (player.PLRBLK.P_ATPOW < player.PLRBLK.P_ATDAM) {
+        queueDirty = true;
         return true; // Death
       }
 
       // Check for victory
       if (game.hasWon) {
+        queueDirty = true;
         return true; // Victory
       }
     }
@@ -288,14 +366,103 @@ bool Scheduler::SCHED() {
   }
 
   // If we hit the catch-up limit, drain excess accumulator to prevent spiral
+  bool capped = ticksProcessed >= MAX_CATCHUP && accumulator >= TICK_STEP;
   if (ticksProcessed >= MAX_CATCHUP && accumulator > TICK_STEP) {
     accumulator = TICK_STEP - 1;
   }
+  if (profiler.enabled && ticksProcessed > 0) {
+    profiler.pass(passStart, ticksProcessed, capped);
+  }
 
   schedCtr = 0;
   return false;
 }
 
+// Timeline label for a task, named after its handler
+const char *Scheduler::taskTraceName(int type) {
+  static const char *const names[] = {"CLOCK",  "PLAYER", "LUKNEW", "HSLOW",
+                                      "BURNER", "CREGEN", "CMOVE"};
+  if (type < TID_CLOCK || type > TID_CRTMOVE) {
+    return "task";
+  }
+  return names[type];
+}
+
+// Rebuilds the deadline queue from the TCB table.  Tasks
+// after slot "after" that are already due go straight to
+// the due list (in slot order); everything else is queued.
+void Scheduler::rebuildQueue(int after) {
+  taskQueue.clear();
+  dueTasks.clear();
+  for (int ctr = 0; ctr < TCBPTR; ++ctr) {
+    if (ctr > after && curTime >= TCBLND[ctr].next_time) {
+      dueTasks.push_back(ctr);
+    } else {
+      taskQueue.push_back(QueueEntry(TCBLND[ctr].next_time, ctr));
+    }
+  }
+  std::make_heap(taskQueue.begin(), taskQueue.end(),
+                 std::greater<QueueEntry>());
+  queueDirty = false;
+}
+
+// Pops every task whose deadline has passed.  A popped key
+// that no longer matches the task's next_time (CLOCK is also
+// run from the animation loops) is re-queued under its real
+// deadline instead.
+void Scheduler::collectDueTasks() {
+  dueTasks.clear();
+  while (!taskQueue.empty() && taskQueue.front().first <= curTime) {
+    std::pop_heap(taskQueue.begin(), taskQueue.end(),
+                  std::greater<QueueEntry>());
+    int idx = taskQueue.back().second;
+    taskQueue.pop_back();
+    if (curTime >= TCBLND[idx].next_time) {
+      dueTasks.push_back(idx);
+    } else {
+      queueTask(idx);
+    }
+  }
+  // Same-tick tasks run in TCB order, as they always have
+  std::sort(dueTasks.begin(), dueTasks.end());
+}
+
+// Returns the SDL tick at which SCHED() will next have a
+// task to dispatch: the earliest deadline in the queue, but
+// never before the accumulator reaches the next fixed step.
+// Used by the desktop main loop to sleep between ticks.
+Uint32 Scheduler::nextWakeTime() {
+  Uint32 now = DOD_GetTicks();
+  if (lastFrameTime == 0 || TCBPTR == 0) {
+    return now;
+  }
+
+  Uint32 earliest;
+  if (!queueDirty && !taskQueue.empty()) {
+    earliest = taskQueue.front().first;
+  } else {
+    earliest = TCBLND[0].next_time;
+    for (int ctr = 1; ctr < TCBPTR; ++ctr) {
+      if (TCBLND[ctr].next_time < earliest) {
+        earliest = TCBLND[ctr].next_time;
+      }
+    }
+  }
+
+  Uint32 nextTick = lastFrameTime;
+  if (accumulator < TICK_STEP) {
+    nextTick += TICK_STEP - accumulator;
+  }
+  return (earliest > nextTick) ? earliest : nextTick;
+}
+
+// Queues a task under its current deadline
+void Scheduler::queueTask(int idx) {
+  taskQueue.push_back(QueueEntry(TCBLND[idx].next_time, idx));
+  std::push_heap(taskQueue.begin(), taskQueue.end(),
+                 std::greater<QueueEntry>());
+}
+
 // This is the heart of the game, literally.  It manages
 // the heartbeat, calls for the screen to be redrawn, and
 // polls the OS for key strokes.
@@ -370,6 +537,7 @@ void Scheduler::CLOCK() {
 
 // Gets next available Task Block and updates the index
 int Scheduler::GETTCB() {
+  queueDirty = true;
   ++TCBPTR;
   return (TCBPTR - 1);
 }
@@ -379,7 +547,7 @@ int Scheduler::GETTCB() {
 
 // Used by wizard fade in/out function
 bool Scheduler::fadeLoop() {
-#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_ASYNCIFY__)
+#if defined(DOD_NONBLOCKING)
   // Without ASYNCIFY, blocking fades don't work
   // The non-blocking fade is handled by game state machine
   viewer.displayCopyright();
@@ -396,7 +564,7 @@ bool Scheduler::fadeLoop() {
   Mix_PlayChannel(viewer.fadChannel, creature.buzz, -1);
 
   const Uint32 frameIntervalMs = 16;
-  Uint32 nextFrameTick = SDL_GetTicks();
+  Uint32 nextFrameTick = DOD_GetTicks();
 
   auto handleFadeEvent = [&](const SDL_Event &evt) -> bool {
     switch (evt.type) {
@@ -425,7 +593,7 @@ bool Scheduler::fadeLoop() {
   };
 
   while (true) {
-    Uint32 now = SDL_GetTicks();
+    Uint32 now = DOD_GetTicks();
     if (now < nextFrameTick) {
       Uint32 waitMs = nextFrameTick - now;
       if (SDL_WaitEventTimeout(&event, waitMs)) {
@@ -464,7 +632,7 @@ bool Scheduler::fadeLoop() {
 }
 
 void Scheduler::deathFadeLoop() {
-#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_ASYNCIFY__)
+#if defined(DOD_NONBLOCKING)
   // Without ASYNCIFY, blocking fades don't work - just display and return
   viewer.displayDeath();
   viewer.clearArea(&viewer.TXTPRI);
@@ -516,7 +684,7 @@ void Scheduler::deathFadeLoop() {
 }
 
 void Scheduler::winFadeLoop() {
-#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_ASYNCIFY__)
+#if defined(DOD_NONBLOCKING)
   // Without ASYNCIFY, blocking fades don't work - just display and return
   viewer.displayWinner();
   viewer.clearArea(&viewer.TXTPRI);
@@ -642,529 +810,321 @@ bool Scheduler::EscHandler(const SDL_Keysym *keysym) {
   }
 }
 
-void Scheduler::SAVE() {
-  ofstream fout;
-  int ctr;
-  char outstr[64];
+// The fields of each saved game section, in file order.
+// The same functions write binary saves, read them, and
+// read the legacy text format, so the three cannot drift.
+template <class Archive> void Scheduler::ioMaze(Archive &ar) {
+  ar.io(game.LEVEL);
+  ar.io(dungeon.VFTPTR);
+  for (int ctr = 0; ctr < 1024; ++ctr) {
+    ar.io(dungeon.MAZLND[ctr]);
+  }
+}
 
-  fout.open(oslink.gamefile, ios::trunc);
-  if (!fout) {
-    // DISK ERROR
-    viewer.OUTSTR(DERR);
-    viewer.PROMPT();
-    return;
+// Level seeds and vertical features, no longer hard-coded
+template <class Archive> void Scheduler::ioLevels(Archive &ar) {
+  for (int ctr = 0; ctr <= 6; ++ctr) {
+    ar.io(dungeon.LEVTAB[ctr]);
   }
+  for (int ctr = 0; ctr <= 41; ++ctr) {
+    ar.io(dungeon.VFTTAB[ctr]);
+  }
+}
+
+template <class Archive> void Scheduler::ioPlayer(Archive &ar) {
+  ar.io(player.PROW);
+  ar.io(player.PCOL);
+  ar.io(player.POBJWT);
+  ar.io(player.PPOW);
+  ar.io(player.PLHAND);
+  ar.io(player.PRHAND);
+  ar.io(player.PDAM);
+  ar.io(player.PDIR);
+  ar.io(player.PTORCH);
+  ar.io(player.PRLITE);
+  ar.io(player.PMLITE);
+  ar.io(player.FAINT);
+  ar.io(player.BAGPTR);
+  ar.io(player.HEARTF);
+  ar.io(player.HEARTC);
+  ar.io(player.HEARTR);
+  ar.io(player.HEARTS);
+  ar.io(player.HBEATF);
+}
 
-  sprintf(outstr, "%d", game.LEVEL);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", dungeon.VFTPTR);
-  fout << outstr << endl;
+template <class Archive> void Scheduler::ioRNG(Archive &ar) {
+  ar.io(rng.SEED[0]);
+  ar.io(rng.SEED[1]);
+  ar.io(rng.SEED[2]);
+  ar.io(rng.carry);
+}
 
-  for (ctr = 0; ctr < 1024; ++ctr) {
-    sprintf(outstr, "%d", dungeon.MAZLND[ctr]);
-    fout << outstr << endl;
+template <class Archive> void Scheduler::ioCreatures(Archive &ar) {
+  ar.io(creature.FRZFLG);
+  ar.io(creature.CMXPTR);
+  for (int ctr = 0; ctr < 60; ++ctr) {
+    ar.io(creature.CMXLND[ctr]);
   }
-
-  sprintf(outstr, "%d", player.PROW);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", player.PCOL);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", player.POBJWT);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", player.PPOW);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", player.PLHAND);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", player.PRHAND);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", player.PDAM);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", player.PDIR);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", player.PTORCH);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", player.PRLITE);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", player.PMLITE);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", player.FAINT);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", player.BAGPTR);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", player.HEARTF);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", player.HEARTC);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", player.HEARTR);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", player.HEARTS);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", player.HBEATF);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", rng.SEED[0]);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", rng.SEED[1]);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", rng.SEED[2]);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", rng.carry);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", creature.FRZFLG);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", creature.CMXPTR);
-  fout << outstr << endl;
-
-  for (ctr = 0; ctr < 60; ++ctr) {
-    sprintf(outstr, "%d", creature.CMXLND[ctr]);
-    fout << outstr << endl;
+  for (int ctr = 0; ctr < 32; ++ctr) {
+    CCB &ccb = creature.CCBLND[ctr];
+    ar.io(ccb.P_CCPOW);
+    ar.io(ccb.P_CCMGO);
+    ar.io(ccb.P_CCMGD);
+    ar.io(ccb.P_CCPHO);
+    ar.io(ccb.P_CCPHD);
+    ar.io(ccb.P_CCTMV);
+    ar.io(ccb.P_CCTAT);
+    ar.io(ccb.P_CCOBJ);
+    ar.io(ccb.P_CCDAM);
+    ar.io(ccb.P_CCUSE);
+    ar.io(ccb.creature_id);
+    ar.io(ccb.P_CCDIR);
+    ar.io(ccb.P_CCROW);
+    ar.io(ccb.P_CCCOL);
   }
+}
 
-  for (ctr = 0; ctr < 32; ++ctr) {
-    sprintf(outstr, "%d", creature.CCBLND[ctr].P_CCPOW);
-    fout << outstr << endl;
-    sprintf(outstr, "%d", creature.CCBLND[ctr].P_CCMGO);
-    fout << outstr << endl;
-    sprintf(outstr, "%d", creature.CCBLND[ctr].P_CCMGD);
-    fout << outstr << endl;
-    sprintf(outstr, "%d", creature.CCBLND[ctr].P_CCPHO);
-    fout << outstr << endl;
-    sprintf(outstr, "%d", creature.CCBLND[ctr].P_CCPHD);
-    fout << outstr << endl;
-    sprintf(outstr, "%d", creature.CCBLND[ctr].P_CCTMV);
-    fout << outstr << endl;
-    sprintf(outstr, "%d", creature.CCBLND[ctr].P_CCTAT);
-    fout << outstr << endl;
-    sprintf(outstr, "%d", creature.CCBLND[ctr].P_CCOBJ);
-    fout << outstr << endl;
-    sprintf(outstr, "%d", creature.CCBLND[ctr].P_CCDAM);
-    fout << outstr << endl;
-    sprintf(outstr, "%d", creature.CCBLND[ctr].P_CCUSE);
-    fout << outstr << endl;
-    sprintf(outstr, "%d", creature.CCBLND[ctr].creature_id);
-    fout << outstr << endl;
-    sprintf(outstr, "%d", creature.CCBLND[ctr].P_CCDIR);
-    fout << outstr << endl;
-    sprintf(outstr, "%d", creature.CCBLND[ctr].P_CCROW);
-    fout << outstr << endl;
-    sprintf(outstr, "%d", creature.CCBLND[ctr].P_CCCOL);
-    fout << outstr << endl;
+template <class Archive> void Scheduler::ioObjects(Archive &ar) {
+  ar.io(object.OFINDF);
+  ar.io(object.OCBPTR);
+  ar.io(object.OFINDP);
+  for (int ctr = 0; ctr < 72; ++ctr) {
+    OCB &ocb = object.OCBLND[ctr];
+    ar.io(ocb.P_OCPTR);
+    ar.io(ocb.P_OCROW);
+    ar.io(ocb.P_OCCOL);
+    ar.io(ocb.P_OCLVL);
+    ar.io(ocb.P_OCOWN);
+    ar.io(ocb.P_OCXX0);
+    ar.io(ocb.P_OCXX1);
+    ar.io(ocb.P_OCXX2);
+    ar.io(ocb.obj_id);
+    ar.io(ocb.obj_type);
+    ar.io(ocb.obj_reveal_lvl);
+    ar.io(ocb.P_OCMGO);
+    ar.io(ocb.P_OCPHO);
   }
+}
 
-  sprintf(outstr, "%d", object.OFINDF);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", object.OCBPTR);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", object.OFINDP);
-  fout << outstr << endl;
-
-  for (ctr = 0; ctr < 72; ++ctr) {
-    sprintf(outstr, "%d", object.OCBLND[ctr].P_OCPTR);
-    fout << outstr << endl;
-    sprintf(outstr, "%d", object.OCBLND[ctr].P_OCROW);
-    fout << outstr << endl;
-    sprintf(outstr, "%d", object.OCBLND[ctr].P_OCCOL);
-    fout << outstr << endl;
-    sprintf(outstr, "%d", object.OCBLND[ctr].P_OCLVL);
-    fout << outstr << endl;
-    sprintf(outstr, "%d", object.OCBLND[ctr].P_OCOWN);
-    fout << outstr << endl;
-    sprintf(outstr, "%d", object.OCBLND[ctr].P_OCXX0);
-    fout << outstr << endl;
-    sprintf(outstr, "%d", object.OCBLND[ctr].P_OCXX1);
-    fout << outstr << endl;
-    sprintf(outstr, "%d", object.OCBLND[ctr].P_OCXX2);
-    fout << outstr << endl;
-    sprintf(outstr, "%d", object.OCBLND[ctr].obj_id);
-    fout << outstr << endl;
-    sprintf(outstr, "%d", object.OCBLND[ctr].obj_type);
-    fout << outstr << endl;
-    sprintf(outstr, "%d", object.OCBLND[ctr].obj_reveal_lvl);
-    fout << outstr << endl;
-    sprintf(outstr, "%d", object.OCBLND[ctr].P_OCMGO);
-    fout << outstr << endl;
-    sprintf(outstr, "%d", object.OCBLND[ctr].P_OCPHO);
-    fout << outstr << endl;
-  }
+template <class Archive> void Scheduler::ioViewer(Archive &ar) {
+  ar.io(viewer.RLIGHT);
+  ar.io(viewer.MLIGHT);
+  ar.io(viewer.OLIGHT);
+  ar.io(viewer.VXSCAL);
+  ar.io(viewer.VYSCAL);
+  ar.io(viewer.TXBFLG);
+  ar.io(viewer.tcaret);
+  ar.io(viewer.tlen);
+  ar.io(viewer.NEWLIN);
+}
 
-  sprintf(outstr, "%d", viewer.RLIGHT);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", viewer.MLIGHT);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", viewer.OLIGHT);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", viewer.VXSCAL);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", viewer.VYSCAL);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", viewer.TXBFLG);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", viewer.tcaret);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", viewer.tlen);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", viewer.NEWLIN);
-  fout << outstr << endl;
-
-  // Save current game levels' rnd seeds, as they are no longer hard-coded.
-  for (ctr = 0; ctr <= 6; ++ctr) {
-    sprintf(outstr, "%d", dungeon.LEVTAB[ctr]);
-    fout << outstr << endl;
-  }
-  // Save vertical features table, as they are no longer hard-coded.
+template <class Archive> void Scheduler::ioMods(Archive &ar) {
+  ar.io(game.RandomMaze);
+  ar.io(game.ShieldFix);
+  ar.io(game.VisionScroll);
+  ar.io(game.CreaturesIgnoreObjects);
+  ar.io(game.CreaturesInstaRegen);
+  ar.io(game.MarkDoorsOnScrollMaps);
+}
 
-  for (ctr = 0; ctr <= 41; ++ctr) {
-    sprintf(outstr, "%d", dungeon.VFTTAB[ctr]);
-    fout << outstr << endl;
+// Snapshots only: the task table, with times relative to
+// curTime so a restore resumes every task on its old schedule
+template <class Archive> void Scheduler::ioTasks(Archive &ar) {
+  ar.io(TCBPTR);
+  for (int ctr = 0; ctr < 38; ++ctr) {
+    Task &task = TCBLND[ctr];
+    int frequency = task.frequency;
+    int prev = task.prev_time - curTime;
+    int next = task.next_time - curTime;
+    int count = task.count;
+    ar.io(task.type);
+    ar.io(task.data);
+    ar.io(frequency);
+    ar.io(prev);
+    ar.io(next);
+    ar.io(count);
+    task.frequency = frequency;
+    task.prev_time = curTime + prev;
+    task.next_time = curTime + next;
+    task.count = count;
   }
-  sprintf(outstr, "%d", game.RandomMaze);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", game.ShieldFix);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", game.VisionScroll);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", game.CreaturesIgnoreObjects);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", game.CreaturesInstaRegen);
-  fout << outstr << endl;
-  sprintf(outstr, "%d", game.MarkDoorsOnScrollMaps);
-  fout << outstr << endl;
-
-  fout.close();
-
-  // Sync saved games to persistent storage (IndexedDB in Emscripten)
-  oslink.syncSavedGames();
 }
 
-void Scheduler::LOAD() {
-  ifstream fin;
-  int ctr, in;
-  char instr[64];
-
-  fin.open(oslink.gamefile);
-  if (!fin) {
-    // DISK ERROR
-    viewer.OUTSTR(DERR);
-    viewer.PROMPT();
-    return;
+// Serializes the game into "buf" in the binary save format.
+// Does not allocate once "buf" has room for a full save.
+void Scheduler::saveState(std::vector<unsigned char> &buf, bool withTasks) {
+  SaveWriter &ar = saveWriter;
+  ar.clear();
+  ar.begin(SaveFile::SEC_MAZE);
+  ioMaze(ar);
+  ioLevels(ar);
+  ar.begin(SaveFile::SEC_PLAYER);
+  ioPlayer(ar);
+  ar.begin(SaveFile::SEC_RNG);
+  ioRNG(ar);
+  ar.begin(SaveFile::SEC_CREATURES);
+  ioCreatures(ar);
+  ar.begin(SaveFile::SEC_OBJECTS);
+  ioObjects(ar);
+  ar.begin(SaveFile::SEC_VIEWER);
+  ioViewer(ar);
+  ar.begin(SaveFile::SEC_MODS);
+  ioMods(ar);
+  if (withTasks) {
+    ar.begin(SaveFile::SEC_TASKS);
+    ioTasks(ar);
   }
+  ar.finish(buf);
+}
 
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    game.LEVEL = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    dungeon.VFTPTR = in;
-
-  for (ctr = 0; ctr < 1024; ++ctr) {
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      dungeon.MAZLND[ctr] = in;
+// Restores the game from a binary save, or from the legacy
+// text format.  Returns false, changing nothing, if a binary
+// save is damaged or comes from a newer version.
+bool Scheduler::loadState(const unsigned char *data, size_t len) {
+  if (SaveFile::isBinary(data, len)) {
+    SaveReader ar;
+    if (!ar.open(data, len)) {
+      return false;
+    }
+    setOriginalLevels(); // for a save without the optional sections
+    if (ar.section(SaveFile::SEC_MAZE)) {
+      ioMaze(ar);
+      ioLevels(ar);
+    }
+    if (ar.section(SaveFile::SEC_PLAYER)) {
+      ioPlayer(ar);
+    }
+    if (ar.section(SaveFile::SEC_RNG)) {
+      ioRNG(ar);
+    }
+    if (ar.section(SaveFile::SEC_CREATURES)) {
+      ioCreatures(ar);
+    }
+    if (ar.section(SaveFile::SEC_OBJECTS)) {
+      ioObjects(ar);
+    }
+    dungeon.PackMaze();
+    creature.Reindex();
+    object.Reindex();
+    if (ar.section(SaveFile::SEC_VIEWER)) {
+      ioViewer(ar);
+    }
+    if (ar.section(SaveFile::SEC_MODS)) {
+      ioMods(ar);
+    }
+    if (ar.section(SaveFile::SEC_TASKS)) {
+      ioTasks(ar);
+      queueDirty = true;
+      return true; // a snapshot, restored exactly as taken
+    }
+  } else {
+    LegacySaveReader ar(reinterpret_cast<const char *>(data), len);
+    ioMaze(ar);
+    ioPlayer(ar);
+    ioRNG(ar);
+    ioCreatures(ar);
+    ioObjects(ar);
+    dungeon.PackMaze();
+    creature.Reindex();
+    object.Reindex();
+    ioViewer(ar);
+    // Original save games ended here.
+    if (ar.more()) {
+      ioLevels(ar);
+      ioMods(ar);
+    } else {
+      setOriginalLevels();
+    }
   }
 
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    player.PROW = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    player.PCOL = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    player.POBJWT = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    player.PPOW = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    player.PLHAND = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    player.PRHAND = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    player.PDAM = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    player.PDIR = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    player.PTORCH = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    player.PRLITE = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    player.PMLITE = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    player.FAINT = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    player.BAGPTR = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    player.HEARTF = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    player.HEARTC = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    player.HEARTR = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    player.HEARTS = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    player.HBEATF = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    rng.SEED[0] = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    rng.SEED[1] = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    rng.SEED[2] = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    rng.carry = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    creature.FRZFLG = in;
   // Always reset FRZFLG to 0 after load - saved games shouldn't start frozen.
   // This also works around a potential bug where FRZFLG could become corrupted.
   creature.FRZFLG = 0;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    creature.CMXPTR = in;
-
-  for (ctr = 0; ctr < 60; ++ctr) {
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      creature.CMXLND[ctr] = in;
-  }
+  return true;
+}
 
-  for (ctr = 0; ctr < 32; ++ctr) {
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      creature.CCBLND[ctr].P_CCPOW = in;
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      creature.CCBLND[ctr].P_CCMGO = in;
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      creature.CCBLND[ctr].P_CCMGD = in;
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      creature.CCBLND[ctr].P_CCPHO = in;
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      creature.CCBLND[ctr].P_CCPHD = in;
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      creature.CCBLND[ctr].P_CCTMV = in;
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      creature.CCBLND[ctr].P_CCTAT = in;
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      creature.CCBLND[ctr].P_CCOBJ = in;
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      creature.CCBLND[ctr].P_CCDAM = in;
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      creature.CCBLND[ctr].P_CCUSE = in;
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      creature.CCBLND[ctr].creature_id = in;
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      creature.CCBLND[ctr].P_CCDIR = in;
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      creature.CCBLND[ctr].P_CCROW = in;
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      creature.CCBLND[ctr].P_CCCOL = in;
+void Scheduler::takeSnapshot() {
+  saveState(snapshots.take(curTime), true);
+}
+
+void Scheduler::requestRewind(int steps) { rewindSteps = steps; }
+
+// Restores the snapshot "steps" back and redraws the view
+bool Scheduler::restoreSnapshot(int steps) {
+  const std::vector<unsigned char> *snap = snapshots.rewind(steps, curTime);
+  if (snap == NULL || !loadState(&(*snap)[0], snap->size())) {
+    return false;
   }
+  game.showLoadedGame();
+  return true;
+}
+
+// Old save game.  Must be old save with original map.
+// Put in original rnd seeds & vertical features table.
+void Scheduler::setOriginalLevels() {
+  static const dodBYTE origLEVTAB[7] = {0x73, 0xC7, 0x5D, 0x97,
+                                        0xF3, 0x13, 0x87};
+  static const dodBYTE origVFTTAB[42] = {
+      0xFF, 1, 0, 23, 0, 15, 4, 0, 20, 17, 1, 28, 30, 0xFF,
+      1, 2, 3, 0, 3, 31, 0, 19, 20, 0, 31, 0, 0xFF, 0xFF,
+      0, 0, 31, 0, 5, 0, 0, 22, 28, 0, 31, 16, 0xFF, 0xFF};
+  memcpy(dungeon.LEVTAB, origLEVTAB, sizeof(origLEVTAB));
+  memcpy(dungeon.VFTTAB, origVFTTAB, sizeof(origVFTTAB));
+  game.RandomMaze = false;
+  game.ShieldFix = false;
+  game.VisionScroll = false;
+  game.CreaturesIgnoreObjects = false;
+  game.CreaturesInstaRegen = false;
+  game.MarkDoorsOnScrollMaps = false;
+}
+
+// Takes a copy of the game between tasks and hands it to the
+// save worker, which writes oslink.gamefile off the game thread
+void Scheduler::SAVE() {
+  std::vector<unsigned char> buf;
+  saveState(buf);
+  saveWorker.submit(buf, oslink.gamefile);
+}
 
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    object.OFINDF = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    object.OCBPTR = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    object.OFINDP = in;
-
-  for (ctr = 0; ctr < 72; ++ctr) {
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      object.OCBLND[ctr].P_OCPTR = in;
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      object.OCBLND[ctr].P_OCROW = in;
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      object.OCBLND[ctr].P_OCCOL = in;
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      object.OCBLND[ctr].P_OCLVL = in;
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      object.OCBLND[ctr].P_OCOWN = in;
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      object.OCBLND[ctr].P_OCXX0 = in;
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      object.OCBLND[ctr].P_OCXX1 = in;
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      object.OCBLND[ctr].P_OCXX2 = in;
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      object.OCBLND[ctr].obj_id = in;
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      object.OCBLND[ctr].obj_type = in;
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      object.OCBLND[ctr].obj_reveal_lvl = in;
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      object.OCBLND[ctr].P_OCMGO = in;
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      object.OCBLND[ctr].P_OCPHO = in;
+// Reports saves that finished since the last frame
+void Scheduler::pollSaves() {
+  bool ok;
+  while (saveWorker.poll(ok)) {
+    viewer.OUTSTR(ok ? DSAVE : DERR);
+    viewer.PROMPT();
   }
+}
 
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    viewer.RLIGHT = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    viewer.MLIGHT = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    viewer.OLIGHT = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    viewer.VXSCAL = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    viewer.VYSCAL = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    viewer.TXBFLG = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    viewer.tcaret = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    viewer.tlen = in;
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in))
-    viewer.NEWLIN = in;
-  // Original save games ended here.
-
-  fin >> instr;
-  if (1 == sscanf(instr, "%d", &in)) // Do we have more data to load?  Yes:
-  {
-    // Load current game levels' rnd seeds, as they are no longer hard-coded.
-    dungeon.LEVTAB[0] = in;
-    for (ctr = 1; ctr <= 6; ++ctr) {
-      fin >> instr;
-      if (1 == sscanf(instr, "%d", &in))
-        dungeon.LEVTAB[ctr] = in;
-    }
+// Waits for pending saves, before quitting
+void Scheduler::finishSaves() { saveWorker.shutdown(); }
 
-    // Load vertical features table, as they are no longer hard-coded.
-    for (ctr = 0; ctr <= 41; ++ctr) {
-      fin >> instr;
-      if (1 == sscanf(instr, "%d", &in))
-        dungeon.VFTTAB[ctr] = in;
+// Waits for saves queued to one file, before it is read or deleted
+void Scheduler::waitForSave(const char *fn) { saveWorker.wait(fn); }
+
+// Reads oslink.gamefile with a single read, once any save
+// still being written to it has finished
+void Scheduler::LOAD() {
+  std::vector<unsigned char> buf;
+  bool ok = false;
+
+  waitForSave(oslink.gamefile);
+  FILE *fptr = fopen(oslink.gamefile, "rb");
+  if (fptr != NULL) {
+    if (fseek(fptr, 0, SEEK_END) == 0) {
+      long len = ftell(fptr);
+      if (len > 0 && fseek(fptr, 0, SEEK_SET) == 0) {
+        buf.resize(len);
+        ok = (fread(&buf[0], 1, buf.size(), fptr) == buf.size());
+      }
     }
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      game.RandomMaze = in;
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      game.ShieldFix = in;
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      game.VisionScroll = in;
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      game.CreaturesIgnoreObjects = in;
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      game.CreaturesInstaRegen = in;
-    fin >> instr;
-    if (1 == sscanf(instr, "%d", &in))
-      game.MarkDoorsOnScrollMaps = in;
-  } else { // Do we have more data to load?  No:
-    // Old save game.  Must be old save with original map.
-    // Put in original rnd seeds & vertical features table.
-    dungeon.LEVTAB[0] = 0x73;
-    dungeon.LEVTAB[1] = 0xC7;
-    dungeon.LEVTAB[2] = 0x5D;
-    dungeon.LEVTAB[3] = 0x97;
-    dungeon.LEVTAB[4] = 0xF3;
-    dungeon.LEVTAB[5] = 0x13;
-    dungeon.LEVTAB[6] = 0x87;
-    dungeon.VFTTAB[0] = -1;
-    dungeon.VFTTAB[1] = 1;
-    dungeon.VFTTAB[2] = 0;
-    dungeon.VFTTAB[3] = 23;
-    dungeon.VFTTAB[4] = 0;
-    dungeon.VFTTAB[5] = 15;
-    dungeon.VFTTAB[6] = 4;
-    dungeon.VFTTAB[7] = 0;
-    dungeon.VFTTAB[8] = 20;
-    dungeon.VFTTAB[9] = 17;
-    dungeon.VFTTAB[10] = 1;
-    dungeon.VFTTAB[11] = 28;
-    dungeon.VFTTAB[12] = 30;
-    dungeon.VFTTAB[13] = -1;
-    dungeon.VFTTAB[14] = 1;
-    dungeon.VFTTAB[15] = 2;
-    dungeon.VFTTAB[16] = 3;
-    dungeon.VFTTAB[17] = 0;
-    dungeon.VFTTAB[18] = 3;
-    dungeon.VFTTAB[19] = 31;
-    dungeon.VFTTAB[20] = 0;
-    dungeon.VFTTAB[21] = 19;
-    dungeon.VFTTAB[22] = 20;
-    dungeon.VFTTAB[23] = 0;
-    dungeon.VFTTAB[24] = 31;
-    dungeon.VFTTAB[25] = 0;
-    dungeon.VFTTAB[26] = -1;
-    dungeon.VFTTAB[27] = -1;
-    dungeon.VFTTAB[28] = 0;
-    dungeon.VFTTAB[29] = 0;
-    dungeon.VFTTAB[30] = 31;
-    dungeon.VFTTAB[31] = 0;
-    dungeon.VFTTAB[32] = 5;
-    dungeon.VFTTAB[33] = 0;
-    dungeon.VFTTAB[34] = 0;
-    dungeon.VFTTAB[35] = 22;
-    dungeon.VFTTAB[36] = 28;
-    dungeon.VFTTAB[37] = 0;
-    dungeon.VFTTAB[38] = 31;
-    dungeon.VFTTAB[39] = 16;
-    dungeon.VFTTAB[40] = -1;
-    dungeon.VFTTAB[41] = -1;
-    game.RandomMaze = false;
-    game.ShieldFix = false;
-    game.VisionScroll = false;
-    game.CreaturesIgnoreObjects = false;
-    game.CreaturesInstaRegen = false;
-    game.MarkDoorsOnScrollMaps = false;
-  } // Do we have more data to load?
-
-  fin.close();
+    fclose(fptr);
+  }
+
+  if (!ok || !loadState(&buf[0], buf.size())) {
+    // DISK ERROR
+    viewer.OUTSTR(DERR);
+    viewer.PROMPT();
+  }
 }
 
 /***********************************************************************
@@ -1177,18 +1137,19 @@ void Scheduler::LOAD() {
 ***********************************************************************/
 void Scheduler::pause(bool state) {
   // The current pause state of the game
-  static bool curState = false;
-  static Uint32 savedTime;
+  static DOD_CONTEXT_LOCAL bool curState = false;
+  static DOD_CONTEXT_LOCAL Uint32 savedTime;
 
   if (!curState && state) {
     savedTime = curTime;
   } else if (curState && !state) {
-    curTime = SDL_GetTicks();
+    curTime = DOD_GetTicks();
 
     for (int i = 0; i < TCBPTR; i++) {
       TCBLND[i].next_time += (curTime - savedTime);
       TCBLND[i].prev_time += (curTime - savedTime);
     }
+    queueDirty = true;
   }
   return;
 }
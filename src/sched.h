@@ -18,7 +18,12 @@ is held by Douglas J. Morgan.
 #define DOD_SCHEDULER_HEADER
 
 #include "dod.h"
+#include "profiler.h"
+#include "savefile.h"
+#include "saveworker.h"
+#include "snapshot.h"
 #include <functional>
+#include <utility>
 #include <vector>
 
 class Scheduler {
@@ -43,11 +48,18 @@ public:
   void Reset();
   void SAVE();
   void LOAD();
+  void pollSaves();
+  void finishSaves();
+  void waitForSave(const char *fn);
+  void saveState(std::vector<unsigned char> &buf, bool withTasks = false);
+  bool loadState(const unsigned char *data, size_t len);
+  void requestRewind(int steps); // restores a snapshot at the next safe point
   void LoadSounds();
   bool EscCheck();
   bool EscHandler(const SDL_Keysym *keysym);
   void pause(bool state);
   void updateCreatureRegen(int newTime);
+  Uint32 nextWakeTime(); // SDL tick at which SCHED() next has work due
   void ConfigureChannelSync(int channelCount);
 
   using WaitPump = std::function<bool()>;
@@ -60,6 +72,7 @@ public:
   Task TCBLND[38];
 
   dodBYTE DERR[15];
+  dodBYTE DSAVE[15];
 
   enum { // task IDs
     TID_CLOCK = 0,
@@ -80,6 +93,12 @@ public:
   static const Uint32 TICK_STEP = 17; // Fixed tick step in ms (original game timing)
   static const Uint32 MAX_CATCHUP = 18; // Max ticks per frame (18*17ms=306ms catch-up for mobile)
 
+  // Per-task timing, off unless SETOPT PROFILE ON
+  SchedProfiler profiler;
+
+  // Rewind snapshots, taken during play (not the demo)
+  SnapshotRing snapshots;
+
   Mix_Chunk *hrtSound[2];
   int hrtChannel;
 
@@ -97,9 +116,40 @@ private:
 
   int schedCtr = 0;
 
+  // Deadline queue: a min-heap of (next_time, TCB index) so each tick only
+  // visits tasks that are actually due.  Handlers still write next_time
+  // directly; heap keys are validated when popped and re-keyed if stale.
+  typedef std::pair<Uint32, int> QueueEntry;
+  std::vector<QueueEntry> taskQueue;
+  std::vector<int> dueTasks;
+  bool queueDirty = true;
+
+  SaveWriter saveWriter; // reused, so snapshots do not allocate
+  SaveWorker saveWorker; // writes saved games off the game thread
+  int rewindSteps = 0;   // pending REWIND request
+
   static Scheduler *instance;
 
 private:
+  // Saved game sections (see savefile.h)
+  template <class Archive> void ioMaze(Archive &ar);
+  template <class Archive> void ioLevels(Archive &ar);
+  template <class Archive> void ioPlayer(Archive &ar);
+  template <class Archive> void ioRNG(Archive &ar);
+  template <class Archive> void ioCreatures(Archive &ar);
+  template <class Archive> void ioObjects(Archive &ar);
+  template <class Archive> void ioViewer(Archive &ar);
+  template <class Archive> void ioMods(Archive &ar);
+  template <class Archive> void ioTasks(Archive &ar);
+  void setOriginalLevels();
+  void takeSnapshot();
+  bool restoreSnapshot(int steps);
+
+  static const char *taskTraceName(int type);
+  void rebuildQueue(int after);
+  void collectDueTasks();
+  void queueTask(int idx);
+
   void OnChannelFinished(int channel);
   SDL_sem *GetChannelSemaphore(int channel);
   static void ChannelFinishedThunk(int channel);
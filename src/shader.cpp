@@ -10,27 +10,49 @@
 #include "oslink.h"
 #include <cstdio>
 #include <cstring>
-
-// Global shader manager instance
-ShaderManager shaderMgr;
+#include <vector>
 
 // External reference to OS_Link for window dimensions
-extern OS_Link oslink;
+extern DOD_CONTEXT_LOCAL OS_Link &oslink;
+
+// Artifact colors (tuned to match MC1372 composite output)
+static const float artifactBlack[3] = {0.0f, 0.0f, 0.0f};
+static const float artifactCyan[3] = {0.0f, 0.85f, 0.90f};
+static const float artifactOrange[3] = {1.0f, 0.45f, 0.0f};
+static const float artifactWhite[3] = {1.0f, 1.0f, 1.0f};
+
+// Share of the last frame a pixel keeps, with phosphor persistence
+static const float phosphorPersistence = 0.5f;
+
+// Darkening of every other half row, with scanlines
+static const float scanlineStrength = 0.3f;
 
 ShaderManager::ShaderManager()
-    : m_fbo(0)
-    , m_renderTexture(0)
+    : m_resolvedIdx(0)
     , m_texWidth(0)
     , m_texHeight(0)
+    , m_lutTexture(0)
     , m_artifactProgram(0)
+    , m_presentProgram(0)
     , m_vertexShader(0)
     , m_fragmentShader(0)
+    , m_presentShader(0)
     , m_textureLoc(-1)
+    , m_lutLoc(-1)
+    , m_previousLoc(-1)
     , m_resolutionLoc(-1)
     , m_phaseFlipLoc(-1)
+    , m_persistenceLoc(-1)
+    , m_presentTextureLoc(-1)
+    , m_rowsLoc(-1)
+    , m_scanlineLoc(-1)
     , m_quadVBO(0)
     , m_initialized(false)
 {
+    m_scene.fbo = m_scene.texture = 0;
+    for (int ctr = 0; ctr < 2; ++ctr) {
+        m_resolved[ctr].fbo = m_resolved[ctr].texture = 0;
+    }
 }
 
 ShaderManager::~ShaderManager()
@@ -44,9 +66,14 @@ bool ShaderManager::init()
         return true;
     }
 
-    // Create render target at native CoCo resolution (256x192)
-    if (!createRenderTarget(256, 192)) {
+    // Create render targets at native CoCo resolution (256x192)
+    m_texWidth = 256;
+    m_texHeight = 192;
+    if (!createRenderTarget(m_scene, m_texWidth, m_texHeight) ||
+        !createRenderTarget(m_resolved[0], m_texWidth, m_texHeight) ||
+        !createRenderTarget(m_resolved[1], m_texWidth, m_texHeight)) {
         fprintf(stderr, "ShaderManager: Failed to create render target\n");
+        shutdown();
         return false;
     }
 
@@ -54,17 +81,12 @@ bool ShaderManager::init()
     if (!loadArtifactShader()) {
         fprintf(stderr, "ShaderManager: Failed to load artifact shader\n");
         // Clean up partial initialization
-        if (m_renderTexture) {
-            glDeleteTextures(1, &m_renderTexture);
-            m_renderTexture = 0;
-        }
-        if (m_fbo) {
-            glDeleteFramebuffers(1, &m_fbo);
-            m_fbo = 0;
-        }
+        shutdown();
         return false;
     }
 
+    createArtifactLUT();
+
     // Create fullscreen quad for post-processing
     createFullscreenQuad();
 
@@ -83,6 +105,10 @@ void ShaderManager::shutdown()
         glDeleteProgram(m_artifactProgram);
         m_artifactProgram = 0;
     }
+    if (m_presentProgram) {
+        glDeleteProgram(m_presentProgram);
+        m_presentProgram = 0;
+    }
     if (m_vertexShader) {
         glDeleteShader(m_vertexShader);
         m_vertexShader = 0;
@@ -91,31 +117,35 @@ void ShaderManager::shutdown()
         glDeleteShader(m_fragmentShader);
         m_fragmentShader = 0;
     }
-    if (m_renderTexture) {
-        glDeleteTextures(1, &m_renderTexture);
-        m_renderTexture = 0;
+    if (m_presentShader) {
+        glDeleteShader(m_presentShader);
+        m_presentShader = 0;
     }
-    if (m_fbo) {
-        glDeleteFramebuffers(1, &m_fbo);
-        m_fbo = 0;
+    if (m_lutTexture) {
+        glDeleteTextures(1, &m_lutTexture);
+        m_lutTexture = 0;
     }
+    deleteRenderTarget(m_scene);
+    deleteRenderTarget(m_resolved[0]);
+    deleteRenderTarget(m_resolved[1]);
     m_initialized = false;
 }
 
-bool ShaderManager::createRenderTarget(int width, int height)
+bool ShaderManager::createRenderTarget(RenderTarget& target, int width,
+                                       int height)
 {
-    m_texWidth = width;
-    m_texHeight = height;
-
     // Create framebuffer object
-    glGenFramebuffers(1, &m_fbo);
-    glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
-
-    // Create texture to render to
-    glGenTextures(1, &m_renderTexture);
-    glBindTexture(GL_TEXTURE_2D, m_renderTexture);
+    glGenFramebuffers(1, &target.fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, target.fbo);
+
+    // Create texture to render to, black so that the first frame
+    // has no phosphor trail
+    std::vector<unsigned char> black(width * height * 3, 0);
+    glGenTextures(1, &target.texture);
+    glBindTexture(GL_TEXTURE_2D, target.texture);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0,
-                 GL_RGB, GL_UNSIGNED_BYTE, NULL);
+                 GL_RGB, GL_UNSIGNED_BYTE, &black[0]);
 
     // Use NEAREST filtering to preserve pixel-perfect rendering
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
@@ -125,7 +155,7 @@ bool ShaderManager::createRenderTarget(int width, int height)
 
     // Attach texture to framebuffer as color attachment
     glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
-                           GL_TEXTURE_2D, m_renderTexture, 0);
+                           GL_TEXTURE_2D, target.texture, 0);
 
     // Check framebuffer completeness
     GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
@@ -140,6 +170,61 @@ bool ShaderManager::createRenderTarget(int width, int height)
     return true;
 }
 
+void ShaderManager::deleteRenderTarget(RenderTarget& target)
+{
+    if (target.texture) {
+        glDeleteTextures(1, &target.texture);
+        target.texture = 0;
+    }
+    if (target.fbo) {
+        glDeleteFramebuffers(1, &target.fbo);
+        target.fbo = 0;
+    }
+}
+
+// Builds the 8x2 lookup texture the resolve pass reads.  Column
+// left*4 + center*2 + right holds the color of a pixel with that
+// neighborhood; row 0 is the even (orange) phase, row 1 the odd
+// (cyan) one.
+void ShaderManager::createArtifactLUT()
+{
+    unsigned char lut[2][8][3];
+
+    for (int phase = 0; phase < 2; ++phase) {
+        const float* hue = (phase == 0) ? artifactOrange : artifactCyan;
+        for (int idx = 0; idx < 8; ++idx) {
+            bool left = (idx & 4) != 0;
+            bool center = (idx & 2) != 0;
+            bool right = (idx & 1) != 0;
+            for (int ch = 0; ch < 3; ++ch) {
+                float c;
+                if (!center) {
+                    c = artifactBlack[ch];
+                } else if (left && right) {
+                    // Surrounded by white on both sides - stays white
+                    c = artifactWhite[ch];
+                } else if (left || right) {
+                    // Blend toward white next to another white pixel
+                    c = hue[ch] + (artifactWhite[ch] - hue[ch]) * 0.35f;
+                } else {
+                    c = hue[ch];
+                }
+                lut[phase][idx][ch] = (unsigned char)(c * 255.0f + 0.5f);
+            }
+        }
+    }
+
+    glGenTextures(1, &m_lutTexture);
+    glBindTexture(GL_TEXTURE_2D, m_lutTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, 8, 2, 0, GL_RGB, GL_UNSIGNED_BYTE,
+                 lut);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
 bool ShaderManager::compileShader(GLuint shader, const char* source)
 {
     glShaderSource(shader, 1, &source, NULL);
@@ -206,8 +291,33 @@ bool ShaderManager::loadArtifactShader()
 
     // Get uniform locations
     m_textureLoc = glGetUniformLocation(m_artifactProgram, "u_texture");
+    m_lutLoc = glGetUniformLocation(m_artifactProgram, "u_lut");
+    m_previousLoc = glGetUniformLocation(m_artifactProgram, "u_previous");
     m_resolutionLoc = glGetUniformLocation(m_artifactProgram, "u_resolution");
     m_phaseFlipLoc = glGetUniformLocation(m_artifactProgram, "u_phaseFlip");
+    m_persistenceLoc =
+        glGetUniformLocation(m_artifactProgram, "u_persistence");
+
+    // The present pass shares the vertex shader
+    m_presentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    if (!compileShader(m_presentShader, PRESENT_FRAGMENT_SHADER)) {
+        fprintf(stderr, "ShaderManager: Fragment shader compilation failed\n");
+        return false;
+    }
+
+    m_presentProgram = glCreateProgram();
+    glAttachShader(m_presentProgram, m_vertexShader);
+    glAttachShader(m_presentProgram, m_presentShader);
+    glBindAttribLocation(m_presentProgram, 0, "a_position");
+    glBindAttribLocation(m_presentProgram, 1, "a_texcoord");
+    if (!linkProgram(m_presentProgram)) {
+        fprintf(stderr, "ShaderManager: Program linking failed\n");
+        return false;
+    }
+
+    m_presentTextureLoc = glGetUniformLocation(m_presentProgram, "u_texture");
+    m_rowsLoc = glGetUniformLocation(m_presentProgram, "u_rows");
+    m_scanlineLoc = glGetUniformLocation(m_presentProgram, "u_scanline");
 
     return true;
 }
@@ -230,10 +340,33 @@ void ShaderManager::createFullscreenQuad()
     glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
+void ShaderManager::drawFullscreenQuad()
+{
+    // Set up vertex attributes and draw fullscreen quad
+    glBindBuffer(GL_ARRAY_BUFFER, m_quadVBO);
+
+    glEnableVertexAttribArray(0);
+    glEnableVertexAttribArray(1);
+
+    // Position attribute (location 0): 2 floats, stride 4 floats, offset 0
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
+    // Texcoord attribute (location 1): 2 floats, stride 4 floats, offset 2 floats
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float),
+                          (void*)(2 * sizeof(float)));
+
+    // Draw the fullscreen quad as a triangle strip
+    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+
+    // Clean up state
+    glDisableVertexAttribArray(0);
+    glDisableVertexAttribArray(1);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
 void ShaderManager::beginRenderToTexture()
 {
     // Bind our FBO as the render target
-    glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, m_scene.fbo);
 
     // Set viewport to native CoCo resolution
     glViewport(0, 0, m_texWidth, m_texHeight);
@@ -245,46 +378,57 @@ void ShaderManager::endRenderToTexture()
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
 }
 
-void ShaderManager::applyArtifactEffect(bool phaseFlip)
+void ShaderManager::applyArtifactEffect(bool phaseFlip, bool scanlines,
+                                        bool phosphor)
 {
-    // Restore viewport to window size (4:3 aspect ratio)
-    int windowHeight = (int)(oslink.width * 0.75);
-    glViewport(0, 0, oslink.width, windowHeight);
+    // Resolve pass: artifact colors at native resolution, into the
+    // target not holding the previous frame
+    const RenderTarget& previous = m_resolved[m_resolvedIdx];
+    m_resolvedIdx ^= 1;
+    const RenderTarget& resolved = m_resolved[m_resolvedIdx];
 
-    // Clear the default framebuffer
-    glClear(GL_COLOR_BUFFER_BIT);
+    glBindFramebuffer(GL_FRAMEBUFFER, resolved.fbo);
+    glViewport(0, 0, m_texWidth, m_texHeight);
 
-    // Use the artifact shader program
     glUseProgram(m_artifactProgram);
 
-    // Bind the rendered texture
+    glActiveTexture(GL_TEXTURE2);
+    glBindTexture(GL_TEXTURE_2D, previous.texture);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, m_lutTexture);
     glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, m_renderTexture);
+    glBindTexture(GL_TEXTURE_2D, m_scene.texture);
 
-    // Set uniforms
     glUniform1i(m_textureLoc, 0);
+    glUniform1i(m_lutLoc, 1);
+    glUniform1i(m_previousLoc, 2);
     glUniform2f(m_resolutionLoc, (float)m_texWidth, (float)m_texHeight);
-    glUniform1i(m_phaseFlipLoc, phaseFlip ? 1 : 0);
+    glUniform1f(m_phaseFlipLoc, phaseFlip ? 1.0f : 0.0f);
+    glUniform1f(m_persistenceLoc, phosphor ? phosphorPersistence : 0.0f);
 
-    // Set up vertex attributes and draw fullscreen quad
-    glBindBuffer(GL_ARRAY_BUFFER, m_quadVBO);
+    drawFullscreenQuad();
 
-    glEnableVertexAttribArray(0);
-    glEnableVertexAttribArray(1);
+    // Present pass: scale to the window (4:3 aspect ratio)
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    int windowHeight = (int)(oslink.width * 0.75);
+    glViewport(0, 0, oslink.width, windowHeight);
 
-    // Position attribute (location 0): 2 floats, stride 4 floats, offset 0
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
-    // Texcoord attribute (location 1): 2 floats, stride 4 floats, offset 2 floats
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float),
-                          (void*)(2 * sizeof(float)));
+    // Clear the default framebuffer
+    glClear(GL_COLOR_BUFFER_BIT);
 
-    // Draw the fullscreen quad as a triangle strip
-    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    glUseProgram(m_presentProgram);
+    glBindTexture(GL_TEXTURE_2D, resolved.texture);
+    glUniform1i(m_presentTextureLoc, 0);
+    glUniform1f(m_rowsLoc, (float)m_texHeight);
+    glUniform1f(m_scanlineLoc, scanlines ? scanlineStrength : 0.0f);
 
-    // Clean up state
-    glDisableVertexAttribArray(0);
-    glDisableVertexAttribArray(1);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    drawFullscreenQuad();
+
+    glActiveTexture(GL_TEXTURE2);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glActiveTexture(GL_TEXTURE0);
     glBindTexture(GL_TEXTURE_2D, 0);
     glUseProgram(0);
 }
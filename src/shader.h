@@ -3,6 +3,12 @@
  *
  * This provides FBO-based post-processing support for applying authentic
  * CoCo NTSC artifact colors to the rendered game output.
+ *
+ * The scene is drawn into a 256x192 target.  The artifact colors, and
+ * phosphor persistence, are resolved at that size into one of a pair
+ * of targets, which take turns so the other holds the previous frame.
+ * Only the final scale to the window, with optional scanlines, runs
+ * per window pixel.  Every target is made once in init() and reused.
  */
 
 #ifndef DOD_SHADER_HEADER
@@ -22,38 +28,59 @@ public:
     void shutdown();
 
     // FBO operations for render-to-texture
-    bool createRenderTarget(int width, int height);
     void beginRenderToTexture();
     void endRenderToTexture();
 
     // Artifact shader operations
     bool loadArtifactShader();
-    void applyArtifactEffect(bool phaseFlip);
+    void applyArtifactEffect(bool phaseFlip, bool scanlines, bool phosphor);
 
     // State queries
     bool isInitialized() const { return m_initialized; }
 
-private:
-    // Shader compilation helpers
+    // Shader compilation helpers, also used by the vector store
     bool compileShader(GLuint shader, const char* source);
     bool linkProgram(GLuint program);
+
+private:
+    struct RenderTarget {
+        GLuint fbo;
+        GLuint texture;
+    };
+
+    bool createRenderTarget(RenderTarget& target, int width, int height);
+    void deleteRenderTarget(RenderTarget& target);
+    void createArtifactLUT();
     void createFullscreenQuad();
+    void drawFullscreenQuad();
 
     // FBO resources
-    GLuint m_fbo;
-    GLuint m_renderTexture;
+    RenderTarget m_scene;
+    RenderTarget m_resolved[2];
+    int m_resolvedIdx; // m_resolved entry written last
     int m_texWidth;
     int m_texHeight;
 
-    // Shader program
+    // Artifact color for each neighborhood and phase
+    GLuint m_lutTexture;
+
+    // Shader programs
     GLuint m_artifactProgram;
+    GLuint m_presentProgram;
     GLuint m_vertexShader;
     GLuint m_fragmentShader;
+    GLuint m_presentShader;
 
     // Uniform locations
     GLint m_textureLoc;
+    GLint m_lutLoc;
+    GLint m_previousLoc;
     GLint m_resolutionLoc;
     GLint m_phaseFlipLoc;
+    GLint m_persistenceLoc;
+    GLint m_presentTextureLoc;
+    GLint m_rowsLoc;
+    GLint m_scanlineLoc;
 
     // Fullscreen quad VBO
     GLuint m_quadVBO;
@@ -62,6 +89,6 @@ private:
     bool m_initialized;
 };
 
-extern ShaderManager shaderMgr;
+extern DOD_CONTEXT_LOCAL ShaderManager &shaderMgr;
 
 #endif // DOD_SHADER_HEADER
@@ -0,0 +1,48 @@
+/*
+ * snapshot.cpp - In-memory rewind snapshots
+ */
+
+#include "snapshot.h"
+
+SnapshotRing::SnapshotRing() {
+  for (int ctr = 0; ctr < SLOTS; ++ctr) {
+    slots[ctr].reserve(SLOT_BYTES);
+  }
+  clear();
+}
+
+void SnapshotRing::clear() {
+  newest = SLOTS - 1;
+  used = 0;
+  lastTime = 0;
+}
+
+bool SnapshotRing::due(Uint32 now) const {
+  return used == 0 || now - lastTime >= INTERVAL;
+}
+
+// Returns the slot for a new snapshot, overwriting the
+// oldest one once the ring is full
+std::vector<unsigned char> &SnapshotRing::take(Uint32 now) {
+  newest = (newest + 1) % SLOTS;
+  if (used < SLOTS) {
+    ++used;
+  }
+  lastTime = now;
+  return slots[newest];
+}
+
+// Returns the snapshot "steps" back (1 is the latest) and
+// forgets it and every newer one, so repeating a rewind keeps
+// going further back.  The next snapshot is a full interval
+// after "now".  NULL if there are not that many.
+const std::vector<unsigned char> *SnapshotRing::rewind(int steps, Uint32 now) {
+  if (steps < 1 || steps > used) {
+    return NULL;
+  }
+  int slot = (newest - (steps - 1) + SLOTS) % SLOTS;
+  newest = (slot + SLOTS - 1) % SLOTS;
+  used -= steps;
+  lastTime = now;
+  return &slots[slot];
+}
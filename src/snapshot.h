@@ -0,0 +1,40 @@
+/*
+ * snapshot.h - In-memory rewind snapshots
+ *
+ * Every INTERVAL milliseconds of play, Scheduler::SCHED() serializes
+ * the game (the saved game sections plus the task table) into the
+ * next slot of a fixed ring.  REWIND, or the F5 key, restores one of
+ * the last SLOTS snapshots.  All slots are allocated up front, so
+ * taking a snapshot never allocates.
+ */
+
+#ifndef DOD_SNAPSHOT_HEADER
+#define DOD_SNAPSHOT_HEADER
+
+#include "dod.h"
+#include <vector>
+
+class SnapshotRing {
+public:
+  SnapshotRing();
+
+  enum {
+    SLOTS = 10,
+    SLOT_BYTES = 8192, // a snapshot is about 4.5 KB
+    INTERVAL = 10000,  // ms of game time between snapshots
+  };
+
+  bool due(Uint32 now) const;
+  std::vector<unsigned char> &take(Uint32 now);
+  const std::vector<unsigned char> *rewind(int steps, Uint32 now);
+  int count() const { return used; }
+  void clear();
+
+private:
+  std::vector<unsigned char> slots[SLOTS];
+  int newest; // slot of the latest snapshot
+  int used;   // number of valid snapshots
+  Uint32 lastTime;
+};
+
+#endif // DOD_SNAPSHOT_HEADER
@@ -0,0 +1,162 @@
+/*
+ * trace.cpp - Timeline tracing in Chrome trace-event format
+ */
+
+#include "trace.h"
+
+Tracer::Tracer()
+    : ring(NULL), head(0), tail(0), out(NULL), origin(0), usPerTick(0.0),
+      first(true), dropped(0)
+#ifdef DOD_TRACE_THREAD
+      , thread(NULL), lock(NULL), wake(NULL), kicked(false), quit(false)
+#endif
+{
+}
+
+// Opens the trace file and starts recording.  The ring is
+// allocated here, once, so recording never allocates.
+bool Tracer::start(const char *fn) {
+  if (active()) {
+    stop();
+  }
+  out = fopen(fn, "w");
+  if (out == NULL) {
+    return false;
+  }
+  ring = new Event[RING_EVENTS];
+  head.store(0);
+  tail.store(0);
+  origin = now();
+  usPerTick = 1000000.0 / SDL_GetPerformanceFrequency();
+  first = true;
+  dropped = 0;
+  fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", out);
+#ifdef DOD_TRACE_THREAD
+  lock = SDL_CreateMutex();
+  wake = SDL_CreateCond();
+  kicked = false;
+  quit = false;
+  thread = SDL_CreateThread(run, "DoD trace", this);
+#endif
+  return true;
+}
+
+// Writes out what is left and closes the file
+void Tracer::stop() {
+  if (!active()) {
+    return;
+  }
+#ifdef DOD_TRACE_THREAD
+  if (thread != NULL) {
+    SDL_LockMutex(lock);
+    quit = true;
+    SDL_CondSignal(wake);
+    SDL_UnlockMutex(lock);
+    SDL_WaitThread(thread, NULL);
+    thread = NULL;
+  }
+  if (lock != NULL) {
+    SDL_DestroyCond(wake);
+    SDL_DestroyMutex(lock);
+    wake = NULL;
+    lock = NULL;
+  }
+#endif
+  flush(); // the writer has stopped, so this thread may consume
+  fprintf(out, "\n],\"otherData\":{\"droppedEvents\":%lu}}\n", dropped);
+  fclose(out);
+  out = NULL;
+  delete[] ring;
+  ring = NULL;
+}
+
+void Tracer::record(const char *name, const char *cat, Uint64 started,
+                    int arg) {
+  unsigned pos = head.load(std::memory_order_relaxed);
+  if (pos - tail.load(std::memory_order_acquire) >= RING_EVENTS) {
+    ++dropped;
+    return;
+  }
+  Event &ev = ring[pos & (RING_EVENTS - 1)];
+  ev.name = name;
+  ev.cat = cat;
+  ev.start = started;
+  ev.end = now();
+  ev.arg = arg;
+  head.store(pos + 1, std::memory_order_release);
+}
+
+// Called by the main loop between frames.  Wakes the writer
+// once the ring is a quarter full; without one, writes a few
+// events per frame instead of all of them at once.
+void Tracer::idle() {
+  if (!active()) {
+    return;
+  }
+#ifdef DOD_TRACE_THREAD
+  if (thread != NULL) {
+    if (head.load(std::memory_order_relaxed) -
+            tail.load(std::memory_order_relaxed) >=
+        RING_EVENTS / 4) {
+      SDL_LockMutex(lock);
+      kicked = true;
+      SDL_CondSignal(wake);
+      SDL_UnlockMutex(lock);
+    }
+    return;
+  }
+#endif
+  write(IDLE_EVENTS);
+}
+
+// Writes everything recorded.  Only one thread may consume the
+// ring, so with a writer thread this is only called once it has
+// stopped.
+void Tracer::flush() {
+  if (active()) {
+    write(RING_EVENTS);
+  }
+}
+
+#ifdef DOD_TRACE_THREAD
+int Tracer::run(void *self) {
+  Tracer *tracer = static_cast<Tracer *>(self);
+  SDL_LockMutex(tracer->lock);
+  while (!tracer->quit) {
+    if (!tracer->kicked) {
+      SDL_CondWait(tracer->wake, tracer->lock);
+      continue;
+    }
+    tracer->kicked = false;
+    SDL_UnlockMutex(tracer->lock);
+    tracer->write(RING_EVENTS);
+    SDL_LockMutex(tracer->lock);
+  }
+  SDL_UnlockMutex(tracer->lock);
+  return 0;
+}
+#endif
+
+// Formats up to "limit" of the recorded events
+void Tracer::write(unsigned limit) {
+  unsigned pos = tail.load(std::memory_order_relaxed);
+  unsigned end = head.load(std::memory_order_acquire);
+  if (end - pos > limit) {
+    end = pos + limit;
+  }
+  for (; pos != end; ++pos) {
+    const Event &ev = ring[pos & (RING_EVENTS - 1)];
+    double ts = (ev.start - origin) * usPerTick;
+    double dur = (ev.end - ev.start) * usPerTick;
+    fprintf(out,
+            "%s{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\","
+            "\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":1",
+            first ? "" : ",\n", ev.name, ev.cat, ts, dur);
+    if (ev.arg >= 0) {
+      fprintf(out, ",\"args\":{\"creature\":%d}", ev.arg);
+    }
+    fputc('}', out);
+    first = false;
+  }
+  tail.store(pos, std::memory_order_release);
+}
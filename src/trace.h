@@ -0,0 +1,100 @@
+/*
+ * trace.h - Timeline tracing in Chrome trace-event format
+ *
+ * When started (SETOPT TRACE ON), frames, scheduler ticks, task
+ * handlers, draws and buffer swaps are recorded as complete ("X")
+ * events into a preallocated ring buffer.  Recording an event is a
+ * counter read and a slot store.  The output opens directly in
+ * chrome://tracing or ui.perfetto.dev.
+ *
+ * The ring is single-producer, single-consumer: only the game thread
+ * records, and head/tail are atomics, so a writer thread formats and
+ * writes events without a lock.  idle(), called by the main loop
+ * between frames, wakes it once the ring is a quarter full.  Web and
+ * headless builds have no writer thread; there idle() formats at
+ * most IDLE_EVENTS events itself, so no one frame pays for a whole
+ * flush.  When the ring is full, events are dropped and counted
+ * rather than blocking the game.
+ */
+
+#ifndef DOD_TRACE_HEADER
+#define DOD_TRACE_HEADER
+
+#include "dod.h"
+#include <atomic>
+
+#if !defined(__EMSCRIPTEN__) && !defined(DOD_HEADLESS)
+#define DOD_TRACE_THREAD
+#endif
+
+class Tracer {
+public:
+  Tracer();
+
+  enum {
+    RING_EVENTS = 1 << 16, // must be a power of two
+    IDLE_EVENTS = 512,     // written per idle() without a writer thread
+  };
+
+  bool active() const { return ring != NULL; }
+  bool start(const char *fn);
+  void stop();
+
+  Uint64 now() const { return SDL_GetPerformanceCounter(); }
+  void record(const char *name, const char *cat, Uint64 started, int arg);
+
+  void idle();
+  void flush();
+
+private:
+  void write(unsigned limit);
+
+  struct Event {
+    const char *name; // static strings only
+    const char *cat;
+    Uint64 start;
+    Uint64 end;
+    int arg; // creature index for CMOVE, -1 otherwise
+  };
+
+  Event *ring;
+  std::atomic<unsigned> head; // next slot to write
+  std::atomic<unsigned> tail; // next slot to flush
+  FILE *out;
+  Uint64 origin;
+  double usPerTick;
+  bool first;
+  unsigned long dropped;
+
+#ifdef DOD_TRACE_THREAD
+  static int run(void *self);
+
+  SDL_Thread *thread;
+  SDL_mutex *lock;
+  SDL_cond *wake;
+  bool kicked; // idle() asked for a write
+  bool quit;
+#endif
+};
+
+// Records the enclosing block as one event
+class TraceScope {
+public:
+  TraceScope(Tracer &t, const char *n, const char *c, int a = -1)
+      : tracer(t), name(n), cat(c), arg(a),
+        started(t.active() ? t.now() : 0) {}
+  ~TraceScope() {
+    if (started != 0 && tracer.active()) {
+      tracer.record(name, cat, started, arg);
+    }
+  }
+
+private:
+  Tracer &tracer;
+  const char *name;
+  const char *cat;
+  int arg;
+  Uint64 started;
+};
+
+#endif // DOD_TRACE_HEADER
@@ -0,0 +1,219 @@
+/*
+ * vecstore.cpp - GPU-resident vector lists
+ *
+ * A list is stored as its line segments: the vertices of each of
+ * its strips, repeated so that every segment is a GL_LINES pair.
+ * A frame's draws are kept as ranges into the buffer, with the
+ * per-draw values set as uniforms when the frame is flushed.
+ */
+
+#include "vecstore.h"
+#include "vector_shader.h"
+#include "oslink.h"
+#include "shader.h"
+#include <algorithm>
+#include <cstdio>
+
+extern DOD_CONTEXT_LOCAL OS_Link &oslink;
+extern DOD_CONTEXT_LOCAL Coordinate &crd;
+
+VectorStore::VectorStore()
+    : m_program(0)
+    , m_vertexShader(0)
+    , m_fragmentShader(0)
+    , m_vbo(0)
+    , m_scaleLoc(-1)
+    , m_centerLoc(-1)
+    , m_screenLoc(-1)
+    , m_colorLoc(-1)
+    , m_initialized(false)
+    , m_finished(false)
+{
+}
+
+VectorStore::~VectorStore()
+{
+    shutdown();
+}
+
+bool VectorStore::init()
+{
+    if (m_initialized) {
+        return true;
+    }
+
+    m_vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    m_fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    if (!shaderMgr.compileShader(m_vertexShader, VECTOR_VERTEX_SHADER) ||
+        !shaderMgr.compileShader(m_fragmentShader, VECTOR_FRAGMENT_SHADER)) {
+        fprintf(stderr, "VectorStore: Shader compilation failed\n");
+        shutdown();
+        return false;
+    }
+
+    m_program = glCreateProgram();
+    glAttachShader(m_program, m_vertexShader);
+    glAttachShader(m_program, m_fragmentShader);
+    glBindAttribLocation(m_program, 0, "a_position");
+    if (!shaderMgr.linkProgram(m_program)) {
+        fprintf(stderr, "VectorStore: Program linking failed\n");
+        shutdown();
+        return false;
+    }
+
+    m_scaleLoc = glGetUniformLocation(m_program, "u_scale");
+    m_centerLoc = glGetUniformLocation(m_program, "u_center");
+    m_screenLoc = glGetUniformLocation(m_program, "u_screen");
+    m_colorLoc = glGetUniformLocation(m_program, "u_color");
+
+    glGenBuffers(1, &m_vbo);
+
+    m_initialized = true;
+    return true;
+}
+
+void VectorStore::shutdown()
+{
+    if (m_vbo) {
+        glDeleteBuffers(1, &m_vbo);
+        m_vbo = 0;
+    }
+    if (m_program) {
+        glDeleteProgram(m_program);
+        m_program = 0;
+    }
+    if (m_vertexShader) {
+        glDeleteShader(m_vertexShader);
+        m_vertexShader = 0;
+    }
+    if (m_fragmentShader) {
+        glDeleteShader(m_fragmentShader);
+        m_fragmentShader = 0;
+    }
+    m_ranges.clear();
+    m_vertices.clear();
+    m_draws.clear();
+    m_initialized = false;
+    m_finished = false;
+}
+
+void VectorStore::add(const dodBYTE* vla)
+{
+    if (!m_initialized || m_finished) {
+        return;
+    }
+    for (size_t ctr = 0; ctr < m_ranges.size(); ++ctr) {
+        if (m_ranges[ctr].vla == vla) {
+            return; // shared by two tables
+        }
+    }
+
+    Range range;
+    range.vla = vla;
+    range.first = (GLint)(m_vertices.size() / 2);
+
+    // Same walk as Viewer::drawVectorList()
+    int numLists = vla[0];
+    int ctr = 1;
+    for (int curList = 0; curList < numLists; ++curList) {
+        int numVertices = vla[ctr];
+        ++ctr;
+        for (int curVertex = 0; curVertex < numVertices - 1; ++curVertex) {
+            m_vertices.push_back((GLshort)vla[ctr]);
+            m_vertices.push_back((GLshort)vla[ctr + 1]);
+            m_vertices.push_back((GLshort)vla[ctr + 2]);
+            m_vertices.push_back((GLshort)vla[ctr + 3]);
+            ctr += 2;
+        }
+        ctr += 2;
+    }
+
+    range.count = (GLsizei)(m_vertices.size() / 2) - range.first;
+    m_ranges.push_back(range);
+}
+
+void VectorStore::finish()
+{
+    if (!m_initialized || m_finished) {
+        return;
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
+    glBufferData(GL_ARRAY_BUFFER, m_vertices.size() * sizeof(GLshort),
+                 m_vertices.empty() ? NULL : &m_vertices[0], GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    std::sort(m_ranges.begin(), m_ranges.end(),
+              [](const Range& a, const Range& b) { return a.vla < b.vla; });
+    std::vector<GLshort>().swap(m_vertices); // the GPU has them now
+    m_finished = true;
+}
+
+const VectorStore::Range* VectorStore::find(const dodBYTE* vla) const
+{
+    std::vector<Range>::const_iterator it = std::lower_bound(
+        m_ranges.begin(), m_ranges.end(), vla,
+        [](const Range& r, const dodBYTE* v) { return r.vla < v; });
+    if (it != m_ranges.end() && it->vla == vla) {
+        return &*it;
+    }
+    return NULL;
+}
+
+bool VectorStore::queue(const dodBYTE* vla, float scaleX, float scaleY,
+                        float cx, float cy, const GLfloat color[3])
+{
+    if (!m_finished) {
+        return false;
+    }
+    const Range* range = find(vla);
+    if (range == NULL) {
+        return false;
+    }
+
+    Draw draw;
+    draw.first = range->first;
+    draw.count = range->count;
+    draw.scale[0] = scaleX;
+    draw.scale[1] = scaleY;
+    draw.center[0] = cx;
+    draw.center[1] = cy;
+    draw.color[0] = color[0];
+    draw.color[1] = color[1];
+    draw.color[2] = color[2];
+    m_draws.push_back(draw);
+    return true;
+}
+
+void VectorStore::flush()
+{
+    if (m_draws.empty()) {
+        return;
+    }
+
+    // crd.newX()/newY() and the glOrtho projection, as one
+    // scale and offset per axis
+    float x0 = crd.newX(0.0), x1 = crd.newX(1.0);
+    float y0 = crd.newY(0.0), y1 = crd.newY(1.0);
+    float w = (float)oslink.width, h = (float)oslink.height;
+
+    glUseProgram(m_program);
+    glUniform4f(m_screenLoc, 2.0f * (x1 - x0) / w, 2.0f * (y1 - y0) / h,
+                2.0f * x0 / w - 1.0f, 2.0f * y0 / h - 1.0f);
+
+    glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_SHORT, GL_FALSE, 0, (void*)0);
+    for (size_t ctr = 0; ctr < m_draws.size(); ++ctr) {
+        const Draw& draw = m_draws[ctr];
+        glUniform2f(m_scaleLoc, draw.scale[0], draw.scale[1]);
+        glUniform2f(m_centerLoc, draw.center[0], draw.center[1]);
+        glUniform3fv(m_colorLoc, 1, draw.color);
+        glDrawArrays(GL_LINES, draw.first, draw.count);
+    }
+    glDisableVertexAttribArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glUseProgram(0);
+
+    m_draws.clear();
+}
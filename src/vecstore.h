@@ -0,0 +1,84 @@
+/*
+ * vecstore.h - GPU-resident vector lists
+ *
+ * Every line vector list the Viewer draws (walls, doors, creatures,
+ * objects, the wizard...) is constant once the Viewer is built.  The
+ * store packs them all into one static vertex buffer at startup, as
+ * GL_LINES pairs.  queue() records a draw as the list's range in that
+ * buffer plus its scale, center and fade color; flush() binds the
+ * program and buffer once and issues one glDrawArrays per record,
+ * with those as uniforms.  No vertex is touched on the CPU, or sent
+ * again, after startup.
+ *
+ * Lists that were never added, or any list if the shader did not
+ * build, are left to the caller's own line path.
+ */
+
+#ifndef DOD_VECSTORE_HEADER
+#define DOD_VECSTORE_HEADER
+
+#include "dod.h"
+#include <vector>
+
+class VectorStore {
+public:
+    VectorStore();
+    ~VectorStore();
+
+    // Compiles the shader; needs a current GL context
+    bool init();
+    void shutdown();
+
+    // Adds a list to the store; finish() uploads everything added
+    void add(const dodBYTE* vla);
+    void finish();
+
+    // Queues a resident list scaled about (cx,cy), as
+    // drawVectorList() does.  False if the list is not resident.
+    bool queue(const dodBYTE* vla, float scaleX, float scaleY, float cx,
+               float cy, const GLfloat color[3]);
+
+    // Draws everything queued since the last flush
+    void flush();
+
+    bool isInitialized() const { return m_initialized; }
+
+private:
+    struct Range {
+        const dodBYTE* vla;
+        GLint first; // in vertices
+        GLsizei count;
+    };
+
+    // A queued draw of one list
+    struct Draw {
+        GLint first;
+        GLsizei count;
+        GLfloat scale[2];
+        GLfloat center[2];
+        GLfloat color[3];
+    };
+
+    const Range* find(const dodBYTE* vla) const;
+
+    std::vector<Range> m_ranges; // sorted by vla by finish()
+    std::vector<GLshort> m_vertices; // freed once uploaded
+    std::vector<Draw> m_draws;
+
+    GLuint m_program;
+    GLuint m_vertexShader;
+    GLuint m_fragmentShader;
+    GLuint m_vbo;
+
+    GLint m_scaleLoc;
+    GLint m_centerLoc;
+    GLint m_screenLoc;
+    GLint m_colorLoc;
+
+    bool m_initialized;
+    bool m_finished;
+};
+
+extern DOD_CONTEXT_LOCAL VectorStore &vecStore;
+
+#endif // DOD_VECSTORE_HEADER
@@ -0,0 +1,36 @@
+/*
+ * vector_shader.h - Embedded GLSL shaders for resident vector lists
+ *
+ * WebGL 1.0 / GLSL ES 1.0 compatible, like artifact_shader.h.  The
+ * vertex shader applies the same scaling drawVectorList() does on the
+ * CPU, then maps DoD's 256x192 coordinates to clip space.
+ */
+
+#ifndef DOD_VECTOR_SHADER_HEADER
+#define DOD_VECTOR_SHADER_HEADER
+
+// Vertex Shader - scales a vector list about its center
+static const char* VECTOR_VERTEX_SHADER =
+    "attribute vec2 a_position;\n"
+    "uniform vec2 u_scale;   // VXSCALf/127, VYSCALf/127\n"
+    "uniform vec2 u_center;  // VCNTRX, VCNTRY\n"
+    "uniform vec4 u_screen;  // DoD to clip space: scale xy, offset zw\n"
+    "\n"
+    "void main() {\n"
+    "    vec2 pos = (a_position - u_center) * u_scale + u_center;\n"
+    "    gl_Position = vec4(pos * u_screen.xy + u_screen.zw, 0.0, 1.0);\n"
+    "}\n";
+
+// Fragment Shader - flat line color (already faded)
+static const char* VECTOR_FRAGMENT_SHADER =
+    "#ifdef GL_ES\n"
+    "precision mediump float;\n"
+    "#endif\n"
+    "\n"
+    "uniform vec3 u_color;\n"
+    "\n"
+    "void main() {\n"
+    "    gl_FragColor = vec4(u_color, 1.0);\n"
+    "}\n";
+
+#endif // DOD_VECTOR_SHADER_HEADER
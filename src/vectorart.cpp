@@ -0,0 +1,128 @@
+/*
+ * vectorart.cpp - Vector art file format
+ */
+
+#include "vectorart.h"
+#include "savefile.h"
+#include <cstdio>
+#include <cstring>
+
+static const unsigned char artMagic[4] = {'D', 'o', 'D', 'v'};
+
+static void putLE(unsigned char *p, Uint32 v, int bytes) {
+  for (int ctr = 0; ctr < bytes; ++ctr) {
+    p[ctr] = (unsigned char)(v >> (8 * ctr));
+  }
+}
+
+static Uint32 getLE(const unsigned char *p, int bytes) {
+  Uint32 v = 0;
+  for (int ctr = 0; ctr < bytes; ++ctr) {
+    v |= (Uint32)p[ctr] << (8 * ctr);
+  }
+  return v;
+}
+
+// A font list is a quad count and eight coordinates per quad.  A
+// line list is a strip count, then each strip's vertex count and two
+// coordinates per vertex.
+size_t VectorArt::listLength(int id, const dodBYTE *vl, size_t avail) {
+  if (avail < 1) {
+    return 0;
+  }
+  if (id < VectorData::FONT_LISTS) {
+    size_t len = 1 + (size_t)vl[0] * 8;
+    return (len <= avail) ? len : 0;
+  }
+
+  size_t len = 1;
+  for (int strip = 0; strip < vl[0]; ++strip) {
+    if (len >= avail || vl[len] == 0) {
+      return 0;
+    }
+    len += 1 + (size_t)vl[len] * 2;
+  }
+  return (len <= avail) ? len : 0;
+}
+
+bool VectorArt::parse(const unsigned char *data, size_t len,
+                      const dodBYTE *lists[VectorData::LIST_COUNT]) {
+  if (len < HEADER_SIZE || memcmp(data, artMagic, 4) != 0) {
+    return false;
+  }
+  if (getLE(data + 4, 2) > VERSION) {
+    return false; // written by a newer build
+  }
+  if (getLE(data + 8, 4) != SaveFile::crc32(data + HEADER_SIZE,
+                                            len - HEADER_SIZE)) {
+    return false;
+  }
+
+  Uint32 count = getLE(data + 6, 2);
+  if (len < HEADER_SIZE + (size_t)count * ENTRY_SIZE) {
+    return false;
+  }
+
+  const dodBYTE *found[VectorData::LIST_COUNT];
+  memcpy(found, lists, sizeof(found));
+  for (Uint32 ctr = 0; ctr < count; ++ctr) {
+    const unsigned char *entry = data + HEADER_SIZE + ctr * ENTRY_SIZE;
+    Uint32 id = getLE(entry, 4);
+    Uint32 offset = getLE(entry + 4, 4);
+    Uint32 length = getLE(entry + 8, 4);
+    if (offset > len || length > len - offset) {
+      return false;
+    }
+    if (id >= VectorData::LIST_COUNT) {
+      continue;
+    }
+    if (length == 0 || listLength(id, data + offset, length) != length) {
+      return false;
+    }
+    found[id] = data + offset;
+  }
+
+  memcpy(lists, found, sizeof(found));
+  return true;
+}
+
+bool VectorArt::load(const char *fn, std::vector<unsigned char> &buf,
+                     const dodBYTE *lists[VectorData::LIST_COUNT]) {
+  bool ok = false;
+
+  FILE *fptr = fopen(fn, "rb");
+  if (fptr != NULL) {
+    if (fseek(fptr, 0, SEEK_END) == 0) {
+      long len = ftell(fptr);
+      if (len > 0 && fseek(fptr, 0, SEEK_SET) == 0) {
+        buf.resize(len);
+        ok = (fread(&buf[0], 1, buf.size(), fptr) == buf.size());
+      }
+    }
+    fclose(fptr);
+  }
+
+  return ok && parse(&buf[0], buf.size(), lists);
+}
+
+void VectorArt::build(const dodBYTE *const lists[VectorData::LIST_COUNT],
+                      std::vector<unsigned char> &out) {
+  size_t base = HEADER_SIZE + VectorData::LIST_COUNT * ENTRY_SIZE;
+
+  out.assign(base, 0);
+  memcpy(&out[0], artMagic, 4);
+  putLE(&out[4], VERSION, 2);
+  putLE(&out[6], VectorData::LIST_COUNT, 2);
+
+  for (int id = 0; id < VectorData::LIST_COUNT; ++id) {
+    size_t length = listLength(id, lists[id], (size_t)-1);
+    unsigned char *entry = &out[HEADER_SIZE + id * ENTRY_SIZE];
+    putLE(entry, id, 4);
+    putLE(entry + 4, (Uint32)out.size(), 4);
+    putLE(entry + 8, (Uint32)length, 4);
+    out.insert(out.end(), lists[id], lists[id] + length);
+  }
+
+  putLE(&out[8], SaveFile::crc32(&out[HEADER_SIZE], out.size() - HEADER_SIZE),
+        4);
+}
@@ -0,0 +1,56 @@
+/*
+ * vectorart.h - Vector art file format
+ *
+ * A vector art file replaces some or all of the built-in vector lists
+ * (vectordata.h) without rebuilding the game.  It is read with a
+ * single read and the lists are used in place.  All integers are
+ * little-endian:
+ *
+ *   header    "DoDv" magic, u16 format version, u16 list count,
+ *             u32 CRC-32 of everything after the header
+ *   table     for each list: u32 list id, u32 offset, u32 length
+ *   lists     the lists' bytes, back to back
+ *
+ * A list id is its index in VectorData::lists.  A list's bytes are
+ * laid out as the built-in list's are, one u8 per count or
+ * coordinate.  Lists the file leaves out keep their built-in art, and
+ * ids the reader does not know are skipped.  Every list is checked
+ * against its own counts, so a bad file can never make the Viewer
+ * read past the end of a list.
+ */
+
+#ifndef DOD_VECTORART_HEADER
+#define DOD_VECTORART_HEADER
+
+#include "dod.h"
+#include "vectordata.h"
+#include <vector>
+
+namespace VectorArt {
+enum {
+  VERSION = 1,
+  HEADER_SIZE = 12,
+  ENTRY_SIZE = 12,
+};
+
+// Length in bytes of list "id" as its counts describe it, or 0 if
+// they run past "avail" bytes or a strip has no vertices
+size_t listLength(int id, const dodBYTE *vl, size_t avail);
+
+// Points "lists" at the file's lists.  Entries the file does not
+// hold are left alone.  False, with "lists" untouched, if the data is
+// not a valid vector art file.
+bool parse(const unsigned char *data, size_t len,
+           const dodBYTE *lists[VectorData::LIST_COUNT]);
+
+// Reads file "fn" into "buf" and parses it.  The lists point into
+// "buf", which must outlive them.
+bool load(const char *fn, std::vector<unsigned char> &buf,
+          const dodBYTE *lists[VectorData::LIST_COUNT]);
+
+// Builds a file holding every list
+void build(const dodBYTE *const lists[VectorData::LIST_COUNT],
+           std::vector<unsigned char> &out);
+} // namespace VectorArt
+
+#endif // DOD_VECTORART_HEADER
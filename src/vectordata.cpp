@@ -0,0 +1,809 @@
+/*
+ * vectordata.cpp - Built-in vector art
+ *
+ * Same byte values, in the same order, as the original game's lists.
+ */
+
+#include "vectordata.h"
+
+namespace VectorData {
+
+// Font
+
+const dodBYTE A_VLA[33] = {
+    4,
+    1, 1, 2, 1, 2, 7, 1, 7,
+    5, 1, 6, 1, 6, 7, 5, 7,
+    2, 7, 5, 7, 5, 8, 2, 8,
+    2, 3, 5, 3, 5, 4, 2, 4
+};
+
+const dodBYTE B_VLA[49] = {
+    6,
+    1, 1, 2, 1, 2, 8, 1, 8,
+    2, 1, 5, 1, 5, 2, 2, 2,
+    2, 4, 5, 4, 5, 5, 2, 5,
+    2, 7, 5, 7, 5, 8, 2, 8,
+    5, 2, 6, 2, 6, 4, 5, 4,
+    5, 5, 6, 5, 6, 7, 5, 7
+};
+
+const dodBYTE C_VLA[41] = {
+    5,
+    1, 2, 2, 2, 2, 7, 1, 7,
+    2, 1, 5, 1, 5, 2, 2, 2,
+    2, 7, 5, 7, 5, 8, 2, 8,
+    5, 2, 6, 2, 6, 3, 5, 3,
+    5, 6, 6, 6, 6, 7, 5, 7
+};
+
+const dodBYTE D_VLA[33] = {
+    4,
+    1, 1, 5, 1, 5, 2, 1, 2,
+    1, 7, 5, 7, 5, 8, 1, 8,
+    1, 2, 2, 2, 2, 7, 1, 7,
+    5, 2, 6, 2, 6, 7, 5, 7
+};
+
+const dodBYTE E_VLA[33] = {
+    4,
+    1, 1, 2, 1, 2, 8, 1, 8,
+    2, 4, 5, 4, 5, 5, 2, 5,
+    2, 7, 6, 7, 6, 8, 2, 8,
+    2, 1, 6, 1, 6, 2, 2, 2
+};
+
+const dodBYTE F_VLA[25] = {
+    3,
+    1, 1, 2, 1, 2, 8, 1, 8,
+    2, 4, 5, 4, 5, 5, 2, 5,
+    2, 7, 6, 7, 6, 8, 2, 8
+};
+
+const dodBYTE G_VLA[49] = {
+    6,
+    1, 2, 2, 2, 2, 7, 1, 7,
+    2, 7, 6, 7, 6, 8, 2, 8,
+    5, 6, 6, 6, 6, 7, 5, 7,
+    2, 1, 6, 1, 6, 2, 2, 2,
+    5, 2, 6, 2, 6, 3, 5, 3,
+    4, 3, 6, 3, 6, 4, 4, 4
+};
+
+const dodBYTE H_VLA[25] = {
+    3,
+    1, 1, 2, 1, 2, 8, 1, 8,
+    5, 1, 6, 1, 6, 8, 5, 8,
+    2, 4, 5, 4, 5, 5, 2, 5
+};
+
+const dodBYTE I_VLA[25] = {
+    3,
+    2, 1, 5, 1, 5, 2, 2, 2,
+    2, 7, 5, 7, 5, 8, 2, 8,
+    3, 2, 4, 2, 4, 7, 3, 7
+};
+
+const dodBYTE J_VLA[25] = {
+    3,
+    1, 2, 2, 2, 2, 3, 1, 3,
+    2, 1, 5, 1, 5, 2, 2, 2,
+    5, 2, 6, 2, 6, 8, 5, 8
+};
+
+const dodBYTE K_VLA[65] = {
+    8,
+    1, 1, 2, 1, 2, 8, 1, 8,
+    2, 4, 3, 4, 3, 5, 2, 5,
+    3, 5, 4, 5, 4, 6, 3, 6,
+    4, 6, 5, 6, 5, 7, 4, 7,
+    5, 7, 6, 7, 6, 8, 5, 8,
+    5, 1, 6, 1, 6, 2, 5, 2,
+    4, 2, 5, 2, 5, 3, 4, 3,
+    3, 3, 4, 3, 4, 4, 3, 4
+};
+
+const dodBYTE L_VLA[17] = {
+    2,
+    1, 1, 2, 1, 2, 8, 1, 8,
+    2, 1, 6, 1, 6, 2, 2, 2
+};
+
+const dodBYTE M_VLA[41] = {
+    5,
+    1, 1, 2, 1, 2, 8, 1, 8,
+    5, 1, 6, 1, 6, 8, 5, 8,
+    2, 6, 3, 6, 3, 7, 2, 7,
+    4, 6, 5, 6, 5, 7, 4, 7,
+    3, 3, 4, 3, 4, 6, 3, 6
+};
+
+const dodBYTE N_VLA[41] = {
+    5,
+    1, 1, 2, 1, 2, 8, 1, 8,
+    5, 1, 6, 1, 6, 8, 5, 8,
+    2, 5, 3, 5, 3, 6, 2, 6,
+    3, 4, 4, 4, 4, 5, 3, 5,
+    4, 3, 5, 3, 5, 4, 4, 4
+};
+
+const dodBYTE O_VLA[33] = {
+    4,
+    1, 2, 2, 2, 2, 7, 1, 7,
+    5, 2, 6, 2, 6, 7, 5, 7,
+    2, 1, 5, 1, 5, 2, 2, 2,
+    2, 7, 5, 7, 5, 8, 2, 8
+};
+
+const dodBYTE P_VLA[33] = {
+    4,
+    1, 1, 2, 1, 2, 8, 1, 8,
+    2, 4, 5, 4, 5, 5, 2, 5,
+    5, 5, 6, 5, 6, 7, 5, 7,
+    2, 7, 5, 7, 5, 8, 2, 8
+};
+
+const dodBYTE Q_VLA[57] = {
+    7,
+    1, 2, 2, 2, 2, 7, 1, 7,
+    2, 1, 4, 1, 4, 2, 2, 2,
+    2, 7, 5, 7, 5, 8, 2, 8,
+    3, 3, 4, 3, 4, 4, 3, 4,
+    4, 2, 5, 2, 5, 3, 4, 3,
+    5, 1, 6, 1, 6, 2, 5, 2,
+    5, 3, 6, 3, 6, 7, 5, 7
+};
+
+const dodBYTE R_VLA[57] = {
+    7,
+    1, 1, 2, 1, 2, 8, 1, 8,
+    2, 7, 5, 7, 5, 8, 2, 8,
+    2, 4, 5, 4, 5, 5, 2, 5,
+    5, 5, 6, 5, 6, 7, 5, 7,
+    3, 3, 4, 3, 4, 4, 3, 4,
+    4, 2, 5, 2, 5, 3, 4, 3,
+    5, 1, 6, 1, 6, 2, 5, 2
+};
+
+const dodBYTE S_VLA[57] = {
+    7,
+    1, 2, 2, 2, 2, 3, 1, 3,
+    5, 6, 6, 6, 6, 7, 5, 7,
+    2, 1, 5, 1, 5, 2, 2, 2,
+    2, 4, 5, 4, 5, 5, 2, 5,
+    2, 7, 5, 7, 5, 8, 2, 8,
+    1, 5, 2, 5, 2, 7, 1, 7,
+    5, 2, 6, 2, 6, 4, 5, 4
+};
+
+const dodBYTE T_VLA[33] = {
+    4,
+    1, 6, 2, 6, 2, 8, 1, 8,
+    5, 6, 6, 6, 6, 8, 5, 8,
+    2, 7, 5, 7, 5, 8, 2, 8,
+    3, 1, 4, 1, 4, 7, 3, 7
+};
+
+const dodBYTE U_VLA[25] = {
+    3,
+    1, 2, 2, 2, 2, 8, 1, 8,
+    5, 2, 6, 2, 6, 8, 5, 8,
+    2, 1, 5, 1, 5, 2, 2, 2
+};
+
+const dodBYTE V_VLA[41] = {
+    5,
+    1, 5, 2, 5, 2, 8, 1, 8,
+    5, 5, 6, 5, 6, 8, 5, 8,
+    2, 3, 3, 3, 3, 5, 2, 5,
+    4, 3, 5, 3, 5, 5, 4, 5,
+    3, 1, 4, 1, 4, 3, 3, 3
+};
+
+const dodBYTE W_VLA[41] = {
+    5,
+    1, 1, 2, 1, 2, 8, 1, 8,
+    5, 1, 6, 1, 6, 8, 5, 8,
+    2, 2, 3, 2, 3, 3, 2, 3,
+    4, 2, 5, 2, 5, 3, 4, 3,
+    3, 3, 4, 3, 4, 5, 3, 5
+};
+
+const dodBYTE X_VLA[73] = {
+    9,
+    1, 1, 2, 1, 2, 3, 1, 3,
+    5, 1, 6, 1, 6, 3, 5, 3,
+    1, 6, 2, 6, 2, 8, 1, 8,
+    5, 6, 6, 6, 6, 8, 5, 8,
+    2, 3, 3, 3, 3, 4, 2, 4,
+    4, 3, 5, 3, 5, 4, 4, 4,
+    3, 4, 4, 4, 4, 5, 3, 5,
+    2, 5, 3, 5, 3, 6, 2, 6,
+    4, 5, 5, 5, 5, 6, 4, 6
+};
+
+const dodBYTE Y_VLA[41] = {
+    5,
+    3, 1, 4, 1, 4, 5, 3, 5,
+    2, 5, 3, 5, 3, 6, 2, 6,
+    4, 5, 5, 5, 5, 6, 4, 6,
+    1, 6, 2, 6, 2, 8, 1, 8,
+    5, 6, 6, 6, 6, 8, 5, 8
+};
+
+const dodBYTE Z_VLA[57] = {
+    7,
+    1, 1, 6, 1, 6, 2, 1, 2,
+    1, 7, 6, 7, 6, 8, 1, 8,
+    1, 2, 2, 2, 2, 3, 1, 3,
+    2, 3, 3, 3, 3, 4, 2, 4,
+    3, 4, 4, 4, 4, 5, 3, 5,
+    4, 5, 5, 5, 5, 6, 4, 6,
+    5, 6, 6, 6, 6, 7, 5, 7
+};
+
+const dodBYTE NM0_VLA[33] = {
+    4,
+    2, 2, 3, 2, 3, 7, 2, 7,
+    3, 7, 3, 8, 5, 8, 5, 7,
+    5, 7, 6, 7, 6, 2, 5, 2,
+    3, 1, 5, 1, 5, 2, 3, 2
+};
+
+const dodBYTE NM1_VLA[25] = {
+    3,
+    3, 1, 6, 1, 6, 2, 3, 2,
+    4, 2, 5, 2, 5, 8, 4, 8,
+    3, 6, 4, 6, 4, 7, 3, 7
+};
+
+const dodBYTE NM2_VLA[49] = {
+    6,
+    1, 1, 6, 1, 6, 2, 1, 2,
+    1, 2, 2, 2, 2, 4, 1, 4,
+    2, 4, 5, 4, 5, 5, 2, 5,
+    5, 5, 6, 5, 6, 7, 5, 7,
+    5, 7, 5, 8, 2, 8, 2, 7,
+    1, 6, 2, 6, 2, 7, 1, 7
+};
+
+const dodBYTE NM3_VLA[57] = {
+    7,
+    2, 1, 5, 1, 5, 2, 2, 2,
+    1, 2, 2, 2, 2, 3, 1, 3,
+    5, 2, 6, 2, 6, 4, 5, 4,
+    5, 4, 5, 5, 2, 5, 2, 4,
+    5, 5, 6, 5, 6, 7, 5, 7,
+    5, 7, 5, 8, 2, 8, 2, 7,
+    2, 7, 2, 6, 1, 6, 1, 7
+};
+
+const dodBYTE NM4_VLA[33] = {
+    4,
+    4, 1, 5, 1, 5, 8, 4, 8,
+    6, 4, 6, 5, 1, 5, 1, 4,
+    2, 5, 3, 5, 3, 6, 2, 6,
+    3, 6, 4, 6, 4, 7, 3, 7
+};
+
+const dodBYTE NM5_VLA[49] = {
+    6,
+    1, 2, 2, 2, 2, 3, 1, 3,
+    2, 1, 5, 1, 5, 2, 2, 2,
+    5, 2, 6, 2, 6, 5, 5, 5,
+    5, 5, 5, 6, 1, 6, 1, 5,
+    1, 6, 2, 6, 2, 7, 1, 7,
+    1, 7, 6, 7, 6, 8, 1, 8
+};
+
+const dodBYTE NM6_VLA[41] = {
+    5,
+    2, 1, 5, 1, 5, 2, 2, 2,
+    5, 2, 6, 2, 6, 4, 5, 4,
+    1, 2, 2, 2, 2, 7, 1, 7,
+    2, 4, 5, 4, 5, 5, 2, 5,
+    2, 7, 5, 7, 5, 8, 2, 8
+};
+
+const dodBYTE NM7_VLA[49] = {
+    6,
+    1, 1, 2, 1, 2, 3, 1, 3,
+    2, 3, 3, 3, 3, 4, 2, 4,
+    3, 4, 4, 4, 4, 5, 3, 5,
+    4, 5, 5, 5, 5, 6, 4, 6,
+    5, 6, 6, 6, 6, 7, 5, 7,
+    1, 7, 6, 7, 6, 8, 1, 8
+};
+
+const dodBYTE NM8_VLA[57] = {
+    7,
+    2, 1, 5, 1, 5, 2, 2, 2,
+    1, 2, 2, 2, 2, 4, 1, 4,
+    5, 2, 6, 2, 6, 4, 5, 4,
+    2, 4, 5, 4, 5, 5, 2, 5,
+    1, 5, 2, 5, 2, 7, 1, 7,
+    5, 5, 6, 5, 6, 7, 5, 7,
+    2, 7, 5, 7, 5, 8, 2, 8
+};
+
+const dodBYTE NM9_VLA[49] = {
+    6,
+    1, 1, 4, 1, 4, 2, 1, 2,
+    4, 2, 5, 2, 5, 3, 4, 3,
+    5, 3, 6, 3, 6, 7, 5, 7,
+    2, 4, 5, 4, 5, 5, 2, 5,
+    1, 5, 2, 5, 2, 7, 1, 7,
+    2, 7, 5, 7, 5, 8, 2, 8
+};
+
+const dodBYTE PER_VLA[9] = {
+    1,
+    3, 1, 4, 1, 4, 2, 3, 2
+};
+
+const dodBYTE UND_VLA[9] = {
+    1,
+    1, 1, 6, 1, 6, 2, 1, 2
+};
+
+const dodBYTE EXP_VLA[17] = {
+    2,
+    3, 1, 4, 1, 4, 2, 3, 2,
+    3, 4, 4, 4, 4, 8, 3, 8
+};
+
+const dodBYTE QSM_VLA[49] = {
+    6,
+    3, 1, 4, 1, 4, 2, 3, 2,
+    3, 3, 4, 3, 4, 5, 3, 5,
+    4, 4, 5, 4, 5, 5, 4, 5,
+    5, 5, 6, 5, 6, 7, 5, 7,
+    1, 6, 2, 6, 2, 7, 1, 7,
+    2, 7, 5, 7, 5, 8, 2, 8
+};
+
+const dodBYTE SHL_VLA[9] = {
+    1,
+    7, 4, 8, 4, 8, 6, 7, 6
+};
+
+const dodBYTE SHR_VLA[33] = {
+    4,
+    0, 3, 1, 3, 1, 7, 0, 7,
+    2, 3, 3, 3, 3, 7, 2, 7,
+    1, 2, 2, 2, 2, 6, 1, 6,
+    3, 4, 4, 4, 4, 6, 3, 6
+};
+
+const dodBYTE LHL_VLA[17] = {
+    2,
+    6, 4, 7, 4, 7, 6, 6, 6,
+    7, 3, 8, 3, 8, 7, 7, 7
+};
+
+const dodBYTE LHR_VLA[41] = {
+    5,
+    0, 2, 1, 2, 1, 7, 0, 7,
+    1, 1, 2, 1, 2, 6, 1, 6,
+    2, 2, 3, 2, 3, 7, 2, 7,
+    3, 3, 4, 3, 4, 7, 3, 7,
+    4, 4, 5, 4, 5, 6, 4, 6
+};
+
+const dodBYTE FSL_VLA[41] = { // Forward Slash
+    5,
+    1, 1, 2, 1, 2, 3, 1, 3,
+    2, 3, 3, 3, 3, 4, 2, 4,
+    3, 4, 4, 4, 4, 5, 3, 5,
+    4, 5, 5, 5, 5, 6, 4, 6,
+    5, 6, 6, 6, 6, 8, 5, 8
+};
+
+const dodBYTE BSL_VLA[41] = { // Back Slash
+    5,
+    1, 6, 2, 6, 2, 8, 1, 8,
+    2, 5, 3, 5, 3, 6, 2, 6,
+    3, 4, 4, 4, 4, 5, 3, 5,
+    4, 3, 5, 3, 5, 4, 4, 4,
+    5, 1, 6, 1, 6, 3, 5, 3
+};
+
+const dodBYTE PCT_VLA[57] = { // Percent
+    7,
+    1, 1, 2, 1, 2, 3, 1, 3,
+    2, 3, 3, 3, 3, 4, 2, 4,
+    3, 4, 4, 4, 4, 5, 3, 5,
+    4, 5, 5, 5, 5, 6, 4, 6,
+    5, 6, 6, 6, 6, 8, 5, 8,
+    1, 6, 3, 6, 3, 8, 1, 8,
+    4, 1, 6, 1, 6, 3, 4, 3
+};
+
+const dodBYTE PLS_VLA[17] = { // Plus
+    2,
+    3, 2, 4, 2, 4, 7, 3, 7,
+    1, 4, 6, 4, 6, 5, 1, 5
+};
+
+const dodBYTE DSH_VLA[9] = { // Dash
+    1,
+    1, 4, 6, 4, 6, 5, 1, 5
+};
+
+// Creatures, the wizard, the maze and objects
+
+const dodBYTE SP_VLA[39] = {
+    0x02,
+    0x0B, 0xA0, 0x7C, 0xA4, 0x74, 0xA8, 0x78, 0xB0, 0x74, 0xB8, 0x78, 0xB0,
+    0x7C, 0xA8, 0x78, 0xB0, 0x78, 0xB8, 0x78, 0xBC, 0x74, 0xC0, 0x7C,
+    0x07, 0xA8, 0x7C, 0xAA, 0x74, 0xAC, 0x78, 0xB0, 0x7A, 0xB4, 0x78, 0xB6,
+    0x74, 0xB8, 0x7C
+};
+
+const dodBYTE WR_VLA[42] = {
+    0x03,
+    0x03, 0x44, 0x3E, 0x58, 0x44, 0x64, 0x38,
+    0x09, 0x5A, 0x4A, 0x4A, 0x46, 0x50, 0x4C, 0x5A, 0x4A, 0x64, 0x48, 0x66,
+    0x40, 0x5A, 0x4A, 0x5E, 0x56, 0x5A, 0x56,
+    0x07, 0x50, 0x64, 0x56, 0x5A, 0x64, 0x5C, 0x6C, 0x62, 0x62, 0x5E, 0x56,
+    0x5E, 0x50, 0x64
+};
+
+const dodBYTE SC_VLA[41] = {
+    0x02,
+    0x0D, 0x4A, 0x70, 0x4A, 0x6C, 0x46, 0x68, 0x3E, 0x6C, 0x42, 0x74, 0x4A,
+    0x76, 0x52, 0x78, 0x52, 0x7C, 0x4A, 0x7C, 0x42, 0x74, 0x46, 0x78, 0x3E,
+    0x78, 0x42, 0x7C,
+    0x06, 0x5A, 0x7C, 0x5A, 0x78, 0x52, 0x78, 0x4A, 0x7C, 0x4A, 0x80, 0x52,
+    0x80
+};
+
+const dodBYTE BL_VLA[66] = {
+    0x03,
+    0x14, 0x82, 0x52, 0x72, 0x56, 0x6C, 0x64, 0x6A, 0x6E, 0x6A, 0x78, 0x60,
+    0x82, 0x6A, 0x80, 0x68, 0x84, 0x72, 0x7E, 0x80, 0x80, 0x8E, 0x82, 0x94,
+    0x80, 0x98, 0x84, 0x9A, 0x80, 0xA2, 0x82, 0x9C, 0x7C, 0x9A, 0x6C, 0x94,
+    0x5C, 0x8A, 0x56, 0x82, 0x52,
+    0x08, 0x82, 0x56, 0x88, 0x5C, 0x8A, 0x62, 0x80, 0x64, 0x82, 0x56, 0x78,
+    0x5C, 0x76, 0x66, 0x80, 0x64,
+    0x03, 0x74, 0x6C, 0x76, 0x72, 0x90, 0x78
+};
+
+const dodBYTE GL_VLA[141] = {
+    0x04,
+    0x15, 0x7C, 0x50, 0x72, 0x5E, 0x78, 0x6E, 0x70, 0x84, 0x4E, 0x68, 0x30,
+    0x84, 0x48, 0x44, 0x20, 0x54, 0x58, 0x16, 0x72, 0x34, 0x80, 0x5C, 0x8E,
+    0x34, 0xA8, 0x16, 0xE0, 0x58, 0xB8, 0x44, 0xD0, 0x84, 0xB2, 0x70, 0x90,
+    0x84, 0x88, 0x6E, 0x8E, 0x5E, 0x84, 0x50,
+    0x09, 0x70, 0x84, 0x7A, 0x7C, 0x7E, 0x6E, 0x7A, 0x64, 0x80, 0x5C, 0x86,
+    0x64, 0x82, 0x6E, 0x86, 0x7C, 0x90, 0x84,
+    0x0B, 0x7A, 0x52, 0x6A, 0x60, 0x5C, 0x5C, 0x56, 0x4C, 0x4E, 0x48, 0x54,
+    0x4E, 0x4C, 0x4E, 0x54, 0x52, 0x58, 0x60, 0x66, 0x68, 0x74, 0x64,
+    0x1B, 0xA8, 0x16, 0xA2, 0x1A, 0xA6, 0x12, 0xA0, 0x18, 0xA0, 0x1E, 0x96,
+    0x26, 0x8C, 0x2E, 0x86, 0x2A, 0x8A, 0x20, 0x84, 0x12, 0x86, 0x20, 0x80,
+    0x26, 0x7A, 0x20, 0x7C, 0x12, 0x76, 0x20, 0x7A, 0x2A, 0x80, 0x36, 0x86,
+    0x2A, 0x80, 0x2E, 0x7A, 0x2A, 0x74, 0x2E, 0x6A, 0x26, 0x60, 0x1E, 0x60,
+    0x18, 0x5A, 0x12, 0x5E, 0x1A, 0x58, 0x16
+};
+
+const dodBYTE VI_VLA[65] = {
+    0x02,
+    0x0F, 0x82, 0x84, 0x7A, 0x70, 0x7C, 0x5C, 0x7E, 0x5E, 0x82, 0x5E, 0x84,
+    0x5C, 0x82, 0x70, 0x8C, 0x80, 0x88, 0x84, 0x72, 0x84, 0x6C, 0x78, 0x76,
+    0x6A, 0x70, 0x78, 0x74, 0x7C, 0x7E, 0x7C,
+    0x10, 0x78, 0x64, 0x78, 0x60, 0x7C, 0x5C, 0x78, 0x58, 0x78, 0x54, 0x7A,
+    0x52, 0x7E, 0x56, 0x7A, 0x52, 0x86, 0x52, 0x82, 0x56, 0x86, 0x52, 0x88,
+    0x54, 0x88, 0x58, 0x84, 0x5C, 0x88, 0x60, 0x88, 0x64
+};
+
+const dodBYTE S1_VLA[130] = {
+    0x05,
+    0x0A, 0x62, 0x68, 0x70, 0x62, 0x78, 0x5C, 0x80, 0x5E, 0x84, 0x60, 0x84,
+    0x66, 0x7E, 0x68, 0x78, 0x68, 0x72, 0x66, 0x64, 0x6A,
+    0x0C, 0x84, 0x66, 0x88, 0x66, 0x94, 0x70, 0xA0, 0x7A, 0xAE, 0x7C, 0xAA,
+    0x78, 0xAE, 0x78, 0xA2, 0x74, 0x98, 0x6A, 0x8E, 0x60, 0x82, 0x5C, 0x76,
+    0x58,
+    0x08, 0x5C, 0x4E, 0x60, 0x46, 0x62, 0x50, 0x5E, 0x56, 0x5C, 0x4E, 0x54,
+    0x4C, 0x58, 0x54, 0x5E, 0x56,
+    0x0B, 0x5A, 0x6A, 0x56, 0x6C, 0x58, 0x6E, 0x5E, 0x6C, 0x62, 0x78, 0x54,
+    0x7E, 0x58, 0x7A, 0x50, 0x7A, 0x58, 0x76, 0x4C, 0x66, 0x50, 0x62,
+    0x15, 0x54, 0x56, 0x5C, 0x60, 0x66, 0x6C, 0x62, 0x70, 0x56, 0x68, 0x4A,
+    0x5E, 0x4C, 0x52, 0x54, 0x4C, 0x50, 0x48, 0x54, 0x4A, 0x58, 0x44, 0x5E,
+    0x46, 0x60, 0x42, 0x60, 0x46, 0x6C, 0x44, 0x74, 0x48, 0x78, 0x56, 0x68,
+    0x60, 0x64, 0x5C, 0x6E, 0x54, 0x6A, 0x4A
+};
+
+const dodBYTE S2_VLA[126] = {
+    0x05,
+    0x04, 0x62, 0x68, 0x7C, 0x5E, 0x7E, 0x60, 0x64, 0x6A,
+    0x10, 0x84, 0x66, 0x72, 0x5C, 0x76, 0x66, 0x72, 0x6E, 0x84, 0x66, 0x88,
+    0x66, 0x94, 0x70, 0xA0, 0x7A, 0xAE, 0x7C, 0xAA, 0x78, 0xAE, 0x78, 0xA2,
+    0x74, 0x98, 0x6A, 0x8E, 0x60, 0x82, 0x5C, 0x76, 0x58,
+    0x08, 0x5C, 0x4E, 0x60, 0x46, 0x62, 0x50, 0x5E, 0x56, 0x5C, 0x4E, 0x54,
+    0x4C, 0x58, 0x54, 0x5E, 0x56,
+    0x0B, 0x5A, 0x6A, 0x56, 0x6C, 0x58, 0x6E, 0x5E, 0x6C, 0x62, 0x78, 0x54,
+    0x7E, 0x58, 0x7A, 0x50, 0x7A, 0x58, 0x76, 0x4C, 0x66, 0x50, 0x62,
+    0x15, 0x54, 0x56, 0x5C, 0x60, 0x66, 0x6C, 0x62, 0x70, 0x56, 0x68, 0x4A,
+    0x5E, 0x4C, 0x52, 0x54, 0x4C, 0x50, 0x48, 0x54, 0x4A, 0x58, 0x44, 0x5E,
+    0x46, 0x60, 0x42, 0x60, 0x46, 0x6C, 0x44, 0x74, 0x48, 0x78, 0x56, 0x68,
+    0x60, 0x64, 0x5C, 0x6E, 0x54, 0x6A, 0x4A
+};
+
+const dodBYTE K1_VLA[153] = {
+    0x08,
+    0x05, 0x7C, 0x22, 0x84, 0x22, 0x82, 0x24, 0x7E, 0x24, 0x7C, 0x22,
+    0x08, 0x8E, 0x50, 0x88, 0x40, 0x92, 0x2E, 0x9C, 0x40, 0x8C, 0x52, 0x88,
+    0x4C, 0x92, 0x40, 0x8C, 0x3A,
+    0x06, 0x8C, 0x50, 0x98, 0x80, 0xA0, 0x84, 0x90, 0x84, 0x90, 0x7E, 0x82,
+    0x54,
+    0x06, 0x7E, 0x54, 0x6E, 0x7E, 0x6E, 0x84, 0x5C, 0x84, 0x66, 0x80, 0x74,
+    0x50,
+    0x11, 0x8C, 0x50, 0x80, 0x56, 0x72, 0x50, 0x78, 0x40, 0x74, 0x3A, 0x6E,
+    0x2E, 0x7A, 0x2A, 0x7C, 0x1E, 0x80, 0x1A, 0x84, 0x1E, 0x86, 0x2A, 0x92,
+    0x2E, 0x86, 0x2A, 0x86, 0x2E, 0x80, 0x34, 0x7A, 0x2E, 0x7A, 0x2A,
+    0x07, 0x80, 0x34, 0x80, 0x14, 0x7C, 0x14, 0x7E, 0x18, 0x82, 0x18, 0x84,
+    0x14, 0x80, 0x14,
+    0x0E, 0x66, 0x4A, 0x66, 0x46, 0x6A, 0x46, 0x6A, 0x40, 0x5A, 0x40, 0x5A,
+    0x46, 0x5E, 0x46, 0x5E, 0x4A, 0x60, 0x4A, 0x60, 0x50, 0x64, 0x50, 0x64,
+    0x4A, 0x66, 0x4A, 0x74, 0x3A,
+    0x09, 0x6E, 0x2E, 0x66, 0x40, 0x64, 0x40, 0x66, 0x1E, 0x62, 0x14, 0x5E,
+    0x1E, 0x60, 0x40, 0x62, 0x40, 0x62, 0x14
+};
+
+const dodBYTE K2_VLA[149] = {
+    0x08,
+    0x04, 0x7E, 0x1E, 0x7E, 0x28, 0x7C, 0x28, 0x7C, 0x24,
+    0x07, 0x96, 0x2C, 0xA6, 0x34, 0xA4, 0x4C, 0x96, 0x5C, 0x88, 0x4C, 0x86,
+    0x34, 0x96, 0x2C,
+    0x06, 0x8C, 0x50, 0x98, 0x80, 0xA0, 0x84, 0x90, 0x84, 0x90, 0x7E, 0x82,
+    0x54,
+    0x06, 0x7E, 0x54, 0x6E, 0x7E, 0x6E, 0x84, 0x5C, 0x84, 0x66, 0x80, 0x74,
+    0x50,
+    0x11, 0x8C, 0x50, 0x80, 0x56, 0x72, 0x50, 0x78, 0x40, 0x74, 0x3A, 0x6E,
+    0x2E, 0x7A, 0x2A, 0x7C, 0x1E, 0x80, 0x1A, 0x84, 0x1E, 0x86, 0x2A, 0x92,
+    0x2E, 0x86, 0x2A, 0x86, 0x2E, 0x80, 0x34, 0x7A, 0x2E, 0x7A, 0x2A,
+    0x07, 0x80, 0x34, 0x80, 0x14, 0x7C, 0x14, 0x7E, 0x18, 0x82, 0x18, 0x84,
+    0x14, 0x80, 0x14,
+    0x0E, 0x66, 0x4A, 0x66, 0x46, 0x6A, 0x46, 0x6A, 0x40, 0x5A, 0x40, 0x5A,
+    0x46, 0x5E, 0x46, 0x5E, 0x4A, 0x60, 0x4A, 0x60, 0x50, 0x64, 0x50, 0x64,
+    0x4A, 0x66, 0x4A, 0x74, 0x3A,
+    0x09, 0x6E, 0x2E, 0x66, 0x40, 0x64, 0x40, 0x66, 0x1E, 0x62, 0x14, 0x5E,
+    0x1E, 0x60, 0x40, 0x62, 0x40, 0x62, 0x14
+};
+
+const dodBYTE W0_VLA[133] = {
+    0x08,
+    0x0D, 0x7C, 0x40, 0x78, 0x48, 0x78, 0x40, 0x6E, 0x4E, 0x66, 0x40, 0x6E,
+    0x3A, 0x76, 0x36, 0x78, 0x32, 0x7A, 0x2E, 0x74, 0x28, 0x6C, 0x2A, 0x78,
+    0x1C, 0x7E, 0x1C,
+    0x08, 0x82, 0x1C, 0x88, 0x1C, 0x92, 0x24, 0x94, 0x32, 0x88, 0x2C, 0x84,
+    0x2E, 0x86, 0x30, 0x88, 0x2C,
+    0x09, 0x86, 0x30, 0x8E, 0x36, 0xA4, 0x74, 0x84, 0x84, 0x76, 0x82, 0x5E,
+    0x78, 0x6E, 0x5A, 0x84, 0x84, 0x6A, 0x48,
+    0x05, 0x66, 0x40, 0x64, 0x42, 0x5E, 0x38, 0x60, 0x36, 0x66, 0x40,
+    0x05, 0x66, 0x42, 0x62, 0x44, 0x66, 0x4A, 0x68, 0x4C, 0x6E, 0x5A,
+    0x02, 0x70, 0x58, 0x78, 0x48,
+    0x09, 0x84, 0x3E, 0x80, 0x14, 0x7A, 0x34, 0x7A, 0x40, 0x7C, 0x3C, 0x80,
+    0x72, 0x82, 0x50, 0x82, 0x44, 0x84, 0x3E,
+    0x0B, 0x82, 0x28, 0x80, 0x26, 0x7C, 0x28, 0x7E, 0x2A, 0x82, 0x28, 0x80,
+    0x2E, 0x80, 0x32, 0x7E, 0x32, 0x7E, 0x2A, 0x7C, 0x28, 0x7E, 0x2E
+};
+
+const dodBYTE W1_VLA[199] = {
+    0x0A,
+    0x0D, 0x7C, 0x40, 0x78, 0x48, 0x78, 0x40, 0x6E, 0x4E, 0x66, 0x40, 0x6E,
+    0x3A, 0x76, 0x36, 0x78, 0x32, 0x7A, 0x2E, 0x74, 0x28, 0x6C, 0x2A, 0x78,
+    0x1C, 0x7E, 0x1C,
+    0x08, 0x82, 0x1C, 0x88, 0x1C, 0x92, 0x24, 0x94, 0x32, 0x88, 0x2C, 0x84,
+    0x2E, 0x86, 0x30, 0x88, 0x2C,
+    0x09, 0x86, 0x30, 0x8E, 0x36, 0xA4, 0x74, 0x84, 0x84, 0x76, 0x82, 0x5E,
+    0x78, 0x6E, 0x5A, 0x84, 0x84, 0x6A, 0x48,
+    0x05, 0x66, 0x40, 0x64, 0x42, 0x5E, 0x38, 0x60, 0x36, 0x66, 0x40,
+    0x05, 0x66, 0x42, 0x62, 0x44, 0x66, 0x4A, 0x68, 0x4C, 0x6E, 0x5A,
+    0x02, 0x70, 0x58, 0x78, 0x48,
+    0x09, 0x84, 0x3E, 0x80, 0x14, 0x7A, 0x34, 0x7A, 0x40, 0x7C, 0x3C, 0x80,
+    0x72, 0x82, 0x50, 0x82, 0x44, 0x84, 0x3E,
+    0x0B, 0x82, 0x28, 0x80, 0x26, 0x7C, 0x28, 0x7E, 0x2A, 0x82, 0x28, 0x80,
+    0x2E, 0x80, 0x32, 0x7E, 0x32, 0x7E, 0x2A, 0x7C, 0x28, 0x7E, 0x2E,
+    0x10, 0x62, 0x2E, 0x64, 0x32, 0x62, 0x36, 0x5C, 0x3A, 0x56, 0x38, 0x52,
+    0x30, 0x56, 0x28, 0x5A, 0x26, 0x5E, 0x28, 0x5C, 0x28, 0x58, 0x2A, 0x56,
+    0x30, 0x58, 0x34, 0x5C, 0x36, 0x62, 0x32, 0x62, 0x2E,
+    0x10, 0x9A, 0x68, 0x9C, 0x6C, 0x9A, 0x70, 0x94, 0x74, 0x8E, 0x72, 0x8A,
+    0x6A, 0x8E, 0x62, 0x92, 0x60, 0x96, 0x62, 0x94, 0x62, 0x90, 0x64, 0x8E,
+    0x6A, 0x92, 0x6E, 0x96, 0x70, 0x9A, 0x6C, 0x9A, 0x68
+};
+
+const dodBYTE W2_VLA[185] = {
+    0x0C,
+    0x0D, 0x7C, 0x40, 0x78, 0x48, 0x78, 0x40, 0x6E, 0x4E, 0x66, 0x40, 0x6E,
+    0x3A, 0x76, 0x36, 0x78, 0x32, 0x7A, 0x2E, 0x74, 0x28, 0x6C, 0x2A, 0x78,
+    0x1C, 0x7E, 0x1C,
+    0x08, 0x82, 0x1C, 0x88, 0x1C, 0x92, 0x24, 0x94, 0x32, 0x88, 0x2C, 0x84,
+    0x2E, 0x86, 0x30, 0x88, 0x2C,
+    0x09, 0x86, 0x30, 0x8E, 0x36, 0xA4, 0x74, 0x84, 0x84, 0x76, 0x82, 0x5E,
+    0x78, 0x6E, 0x5A, 0x84, 0x84, 0x6A, 0x48,
+    0x05, 0x66, 0x40, 0x64, 0x42, 0x5E, 0x38, 0x60, 0x36, 0x66, 0x40,
+    0x05, 0x66, 0x42, 0x62, 0x44, 0x66, 0x4A, 0x68, 0x4C, 0x6E, 0x5A,
+    0x02, 0x70, 0x58, 0x78, 0x48,
+    0x09, 0x84, 0x3E, 0x80, 0x14, 0x7A, 0x34, 0x7A, 0x40, 0x7C, 0x3C, 0x80,
+    0x72, 0x82, 0x50, 0x82, 0x44, 0x84, 0x3E,
+    0x0B, 0x82, 0x28, 0x80, 0x26, 0x7C, 0x28, 0x7E, 0x2A, 0x82, 0x28, 0x80,
+    0x2E, 0x80, 0x32, 0x7E, 0x32, 0x7E, 0x2A, 0x7C, 0x28, 0x7E, 0x2E,
+    0x06, 0x56, 0x28, 0x5C, 0x40, 0x64, 0x2A, 0x52, 0x36, 0x68, 0x38, 0x56,
+    0x28,
+    0x06, 0x8C, 0x42, 0x8C, 0x50, 0x86, 0x44, 0x90, 0x4A, 0x86, 0x4C, 0x8C,
+    0x42,
+    0x06, 0x92, 0x60, 0x94, 0x78, 0x88, 0x64, 0x9A, 0x6A, 0x8A, 0x74, 0x92,
+    0x60,
+    0x06, 0x74, 0x50, 0x7A, 0x5A, 0x72, 0x56, 0x7A, 0x52, 0x74, 0x5A, 0x74,
+    0x50
+};
+
+const dodBYTE LAD_VLA[56] = {
+    0x0B,
+    0x02, 0x74, 0x18, 0x74, 0x80,
+    0x02, 0x8C, 0x18, 0x8C, 0x80,
+    0x02, 0x74, 0x1C, 0x8C, 0x1C,
+    0x02, 0x74, 0x28, 0x8C, 0x28,
+    0x02, 0x74, 0x34, 0x8C, 0x34,
+    0x02, 0x74, 0x40, 0x8C, 0x40,
+    0x02, 0x74, 0x4C, 0x8C, 0x4C,
+    0x02, 0x74, 0x58, 0x8C, 0x58,
+    0x02, 0x74, 0x64, 0x8C, 0x64,
+    0x02, 0x74, 0x70, 0x8C, 0x70,
+    0x02, 0x74, 0x7B, 0x8C, 0x7B
+};
+
+const dodBYTE HUP_VLA[29] = {
+    0x04,
+    0x06, 0x64, 0x22, 0x5C, 0x18, 0xA4, 0x18, 0x9C, 0x22, 0x64, 0x22, 0x64,
+    0x18,
+    0x02, 0x9C, 0x22, 0x9C, 0x18,
+    0x02, 0x2F, 0x1C, 0x60, 0x1C,
+    0x02, 0xA1, 0x1C, 0xD2, 0x1C
+};
+
+const dodBYTE HDN_VLA[19] = {
+    0x02,
+    0x06, 0x64, 0x76, 0x5C, 0x80, 0xA4, 0x80, 0x9C, 0x76, 0x64, 0x76, 0x64,
+    0x80,
+    0x02, 0x9C, 0x76, 0x9C, 0x80
+};
+
+const dodBYTE CEI_VLA[6] = {
+    0x01,
+    0x02, 0x2F, 0x1C, 0xD1, 0x1C
+};
+
+const dodBYTE LPK_VLA[12] = {
+    0x01,
+    0x05, 0x1C, 0x64, 0x24, 0x6C, 0x20, 0x70, 0x24, 0x78, 0x1C, 0x80
+};
+
+const dodBYTE RPK_VLA[12] = {
+    0x01,
+    0x05, 0xE4, 0x64, 0xDC, 0x6C, 0xE0, 0x70, 0xDC, 0x78, 0xE4, 0x80
+};
+
+const dodBYTE FSD_VLA[8] = {
+    0x01,
+    0x03, 0x6C, 0x71, 0x80, 0x43, 0x94, 0x72
+};
+
+const dodBYTE LSD_VLA[8] = {
+    0x01,
+    0x03, 0x28, 0x80, 0x32, 0x42, 0x3A, 0x75
+};
+
+const dodBYTE RSD_VLA[8] = {
+    0x01,
+    0x03, 0xD8, 0x80, 0xCE, 0x42, 0xC6, 0x75
+};
+
+const dodBYTE RWAL_VLA[10] = {
+    0x01,
+    0x04, 0xE5, 0x10, 0xC0, 0x26, 0xC0, 0x72, 0xE5, 0x88
+};
+
+const dodBYTE LWAL_VLA[10] = {
+    0x01,
+    0x04, 0x1B, 0x10, 0x40, 0x26, 0x40, 0x72, 0x1B, 0x88
+};
+
+const dodBYTE FWAL_VLA[11] = {
+    0x02,
+    0x02, 0x40, 0x26, 0xC0, 0x26,
+    0x02, 0x40, 0x72, 0xC0, 0x72
+};
+
+const dodBYTE RPAS_VLA[15] = {
+    0x02,
+    0x04, 0xE5, 0x26, 0xC0, 0x26, 0xC0, 0x72, 0xE5, 0x72,
+    0x02, 0xE5, 0x10, 0xC0, 0x26
+};
+
+const dodBYTE LPAS_VLA[15] = {
+    0x02,
+    0x04, 0x1D, 0x26, 0x40, 0x26, 0x40, 0x72, 0x1B, 0x72,
+    0x02, 0x1B, 0x10, 0x40, 0x26
+};
+
+const dodBYTE FPAS_VLA[1] = {
+    0x00
+};
+
+const dodBYTE RDOR_VLA[24] = {
+    0x03,
+    0x04, 0xE5, 0x10, 0xC0, 0x26, 0xC0, 0x72, 0xE5, 0x88,
+    0x04, 0xD8, 0x80, 0xD8, 0x41, 0xC8, 0x44, 0xC8, 0x77,
+    0x02, 0xD0, 0x5C, 0xCC, 0x5D
+};
+
+const dodBYTE LDOR_VLA[24] = {
+    0x03,
+    0x04, 0x1B, 0x10, 0x40, 0x26, 0x40, 0x72, 0x1B, 0x88,
+    0x04, 0x28, 0x80, 0x28, 0x41, 0x38, 0x44, 0x38, 0x77,
+    0x02, 0x30, 0x5C, 0x34, 0x5D
+};
+
+const dodBYTE FDOR_VLA[25] = {
+    0x04,
+    0x02, 0x40, 0x26, 0xC0, 0x26,
+    0x02, 0x40, 0x72, 0xC0, 0x72,
+    0x04, 0x6C, 0x72, 0x6C, 0x43, 0x94, 0x43, 0x94, 0x72,
+    0x02, 0x7E, 0x5E, 0x82, 0x5E
+};
+
+const dodBYTE SHIE_VLA[14] = {
+    0x01,
+    0x06, 0xAC, 0x86, 0xC0, 0x80, 0xBA, 0x7A, 0xA8, 0x80, 0xA4, 0x86, 0xAC,
+    0x86
+};
+
+const dodBYTE SWOR_VLA[11] = {
+    0x02,
+    0x02, 0x50, 0x72, 0x64, 0x7C,
+    0x02, 0x52, 0x76, 0x56, 0x72
+};
+
+const dodBYTE TORC_VLA[10] = {
+    0x01,
+    0x04, 0x3C, 0x76, 0x4A, 0x74, 0x48, 0x72, 0x3C, 0x76
+};
+
+const dodBYTE RING_VLA[12] = {
+    0x01,
+    0x05, 0x3C, 0x7A, 0x3E, 0x7C, 0x3C, 0x7E, 0x3A, 0x7C, 0x3C, 0x7A
+};
+
+const dodBYTE SCRO_VLA[12] = {
+    0x01,
+    0x05, 0xC2, 0x76, 0xC0, 0x78, 0xC8, 0x7E, 0xCA, 0x7C, 0xC2, 0x76
+};
+
+const dodBYTE FLAS_VLA[10] = {
+    0x01,
+    0x04, 0xA2, 0x6E, 0xA4, 0x78, 0xA0, 0x78, 0xA2, 0x6E
+};
+
+const dodBYTE LINES[11] = {
+    0x02,
+    0x02, 0x00, 0x10, 0xFF, 0x10,
+    0x02, 0x00, 0x88, 0xFF, 0x88
+};
+
+const dodBYTE* const lists[LIST_COUNT] = {
+    A_VLA, B_VLA, C_VLA, D_VLA, E_VLA, F_VLA, G_VLA, H_VLA, I_VLA, J_VLA,
+    K_VLA, L_VLA, M_VLA, N_VLA, O_VLA, P_VLA, Q_VLA, R_VLA, S_VLA, T_VLA,
+    U_VLA, V_VLA, W_VLA, X_VLA, Y_VLA, Z_VLA, NM0_VLA, NM1_VLA, NM2_VLA,
+    NM3_VLA, NM4_VLA, NM5_VLA, NM6_VLA, NM7_VLA, NM8_VLA, NM9_VLA, PER_VLA,
+    UND_VLA, EXP_VLA, QSM_VLA, SHL_VLA, SHR_VLA, LHL_VLA, LHR_VLA, FSL_VLA,
+    BSL_VLA, PCT_VLA, PLS_VLA, DSH_VLA,
+    SP_VLA, WR_VLA, SC_VLA, BL_VLA, GL_VLA, VI_VLA, S1_VLA, S2_VLA, K1_VLA,
+    K2_VLA, W0_VLA, W1_VLA, W2_VLA, LAD_VLA, HUP_VLA, HDN_VLA, CEI_VLA,
+    LPK_VLA, RPK_VLA, FSD_VLA, LSD_VLA, RSD_VLA, RWAL_VLA, LWAL_VLA,
+    FWAL_VLA, RPAS_VLA, LPAS_VLA, FPAS_VLA, RDOR_VLA, LDOR_VLA, FDOR_VLA,
+    SHIE_VLA, SWOR_VLA, TORC_VLA, RING_VLA, SCRO_VLA, FLAS_VLA, LINES
+};
+
+} // namespace VectorData
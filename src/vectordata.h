@@ -0,0 +1,126 @@
+/*
+ * vectordata.h - Built-in vector art
+ *
+ * The font and line vector lists the Viewer draws, as constant byte
+ * tables.  They used to be decoded from digit and hex strings in the
+ * Viewer constructor; here they are plain initialized data, so they
+ * sit in read-only memory and cost nothing at startup.
+ *
+ * Font lists are a quad count followed by four x,y corners per quad,
+ * in 0-9 character cell units.  Line lists are a strip count, then
+ * for each strip its vertex count and x,y vertices in view
+ * coordinates.
+ */
+
+#ifndef DOD_VECTORDATA_HEADER
+#define DOD_VECTORDATA_HEADER
+
+#include "dod.h"
+
+namespace VectorData {
+
+// Font
+extern const dodBYTE A_VLA[33];
+extern const dodBYTE B_VLA[49];
+extern const dodBYTE C_VLA[41];
+extern const dodBYTE D_VLA[33];
+extern const dodBYTE E_VLA[33];
+extern const dodBYTE F_VLA[25];
+extern const dodBYTE G_VLA[49];
+extern const dodBYTE H_VLA[25];
+extern const dodBYTE I_VLA[25];
+extern const dodBYTE J_VLA[25];
+extern const dodBYTE K_VLA[65];
+extern const dodBYTE L_VLA[17];
+extern const dodBYTE M_VLA[41];
+extern const dodBYTE N_VLA[41];
+extern const dodBYTE O_VLA[33];
+extern const dodBYTE P_VLA[33];
+extern const dodBYTE Q_VLA[57];
+extern const dodBYTE R_VLA[57];
+extern const dodBYTE S_VLA[57];
+extern const dodBYTE T_VLA[33];
+extern const dodBYTE U_VLA[25];
+extern const dodBYTE V_VLA[41];
+extern const dodBYTE W_VLA[41];
+extern const dodBYTE X_VLA[73];
+extern const dodBYTE Y_VLA[41];
+extern const dodBYTE Z_VLA[57];
+extern const dodBYTE NM0_VLA[33];
+extern const dodBYTE NM1_VLA[25];
+extern const dodBYTE NM2_VLA[49];
+extern const dodBYTE NM3_VLA[57];
+extern const dodBYTE NM4_VLA[33];
+extern const dodBYTE NM5_VLA[49];
+extern const dodBYTE NM6_VLA[41];
+extern const dodBYTE NM7_VLA[49];
+extern const dodBYTE NM8_VLA[57];
+extern const dodBYTE NM9_VLA[49];
+extern const dodBYTE PER_VLA[9];
+extern const dodBYTE UND_VLA[9];
+extern const dodBYTE EXP_VLA[17];
+extern const dodBYTE QSM_VLA[49];
+extern const dodBYTE SHL_VLA[9];
+extern const dodBYTE SHR_VLA[33];
+extern const dodBYTE LHL_VLA[17];
+extern const dodBYTE LHR_VLA[41];
+extern const dodBYTE FSL_VLA[41]; // Forward Slash
+extern const dodBYTE BSL_VLA[41]; // Back Slash
+extern const dodBYTE PCT_VLA[57]; // Percent
+extern const dodBYTE PLS_VLA[17]; // Plus
+extern const dodBYTE DSH_VLA[9]; // Dash
+
+// Creatures, the wizard, the maze and objects
+extern const dodBYTE SP_VLA[39];
+extern const dodBYTE WR_VLA[42];
+extern const dodBYTE SC_VLA[41];
+extern const dodBYTE BL_VLA[66];
+extern const dodBYTE GL_VLA[141];
+extern const dodBYTE VI_VLA[65];
+extern const dodBYTE S1_VLA[130];
+extern const dodBYTE S2_VLA[126];
+extern const dodBYTE K1_VLA[153];
+extern const dodBYTE K2_VLA[149];
+extern const dodBYTE W0_VLA[133];
+extern const dodBYTE W1_VLA[199];
+extern const dodBYTE W2_VLA[185];
+extern const dodBYTE LAD_VLA[56];
+extern const dodBYTE HUP_VLA[29];
+extern const dodBYTE HDN_VLA[19];
+extern const dodBYTE CEI_VLA[6];
+extern const dodBYTE LPK_VLA[12];
+extern const dodBYTE RPK_VLA[12];
+extern const dodBYTE FSD_VLA[8];
+extern const dodBYTE LSD_VLA[8];
+extern const dodBYTE RSD_VLA[8];
+extern const dodBYTE RWAL_VLA[10];
+extern const dodBYTE LWAL_VLA[10];
+extern const dodBYTE FWAL_VLA[11];
+extern const dodBYTE RPAS_VLA[15];
+extern const dodBYTE LPAS_VLA[15];
+extern const dodBYTE FPAS_VLA[1];
+extern const dodBYTE RDOR_VLA[24];
+extern const dodBYTE LDOR_VLA[24];
+extern const dodBYTE FDOR_VLA[25];
+extern const dodBYTE SHIE_VLA[14];
+extern const dodBYTE SWOR_VLA[11];
+extern const dodBYTE TORC_VLA[10];
+extern const dodBYTE RING_VLA[12];
+extern const dodBYTE SCRO_VLA[12];
+extern const dodBYTE FLAS_VLA[10];
+extern const dodBYTE LINES[11];
+
+
+enum {
+    FONT_LISTS = 49, // ids below this are font lists
+    LIST_COUNT = 87
+};
+
+// Every list by id, in the order above.  Vector art files
+// (vectorart.h) name lists by these ids, so new lists only ever go
+// on the end.
+extern const dodBYTE* const lists[LIST_COUNT];
+
+} // namespace VectorData
+
+#endif // DOD_VECTORDATA_HEADER
@@ -0,0 +1,34 @@
+/*
+ * view_shader.h - Embedded GLSL shaders for the cached 3D view
+ *
+ * WebGL 1.0 / GLSL ES 1.0 compatible, like artifact_shader.h.  Copies
+ * the cached view texture over the viewport, one texel per pixel.
+ */
+
+#ifndef DOD_VIEW_SHADER_HEADER
+#define DOD_VIEW_SHADER_HEADER
+
+// Vertex Shader - unit quad over the whole viewport
+static const char* VIEW_VERTEX_SHADER =
+    "attribute vec2 a_position;\n"
+    "varying vec2 v_texcoord;\n"
+    "\n"
+    "void main() {\n"
+    "    gl_Position = vec4(a_position * 2.0 - 1.0, 0.0, 1.0);\n"
+    "    v_texcoord = a_position;\n"
+    "}\n";
+
+// Fragment Shader - plain copy
+static const char* VIEW_FRAGMENT_SHADER =
+    "#ifdef GL_ES\n"
+    "precision mediump float;\n"
+    "#endif\n"
+    "\n"
+    "varying vec2 v_texcoord;\n"
+    "uniform sampler2D u_texture;\n"
+    "\n"
+    "void main() {\n"
+    "    gl_FragColor = texture2D(u_texture, v_texcoord);\n"
+    "}\n";
+
+#endif // DOD_VIEW_SHADER_HEADER
@@ -0,0 +1,157 @@
+/*
+ * viewcache.cpp - Cached copies of rendered frames
+ */
+
+#include "viewcache.h"
+#include "view_shader.h"
+#include "shader.h"
+#include <cstdio>
+
+ViewCache::ViewCache()
+    : m_program(0)
+    , m_vertexShader(0)
+    , m_fragmentShader(0)
+    , m_texture(0)
+    , m_quadVBO(0)
+    , m_textureLoc(-1)
+    , m_texWidth(0)
+    , m_texHeight(0)
+    , m_valid(false)
+    , m_initialized(false)
+{
+}
+
+ViewCache::~ViewCache()
+{
+    shutdown();
+}
+
+bool ViewCache::init()
+{
+    if (m_initialized) {
+        return true;
+    }
+
+    m_vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    m_fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    if (!shaderMgr.compileShader(m_vertexShader, VIEW_VERTEX_SHADER) ||
+        !shaderMgr.compileShader(m_fragmentShader, VIEW_FRAGMENT_SHADER)) {
+        fprintf(stderr, "ViewCache: Shader compilation failed\n");
+        shutdown();
+        return false;
+    }
+
+    m_program = glCreateProgram();
+    glAttachShader(m_program, m_vertexShader);
+    glAttachShader(m_program, m_fragmentShader);
+    glBindAttribLocation(m_program, 0, "a_position");
+    if (!shaderMgr.linkProgram(m_program)) {
+        fprintf(stderr, "ViewCache: Program linking failed\n");
+        shutdown();
+        return false;
+    }
+
+    m_textureLoc = glGetUniformLocation(m_program, "u_texture");
+
+    // Unit quad, as a triangle strip
+    float quadVertices[] = {
+        0.0f, 0.0f,
+        1.0f, 0.0f,
+        0.0f, 1.0f,
+        1.0f, 1.0f,
+    };
+    glGenBuffers(1, &m_quadVBO);
+    glBindBuffer(GL_ARRAY_BUFFER, m_quadVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(quadVertices), quadVertices, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glGenTextures(1, &m_texture);
+    glBindTexture(GL_TEXTURE_2D, m_texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    m_initialized = true;
+    return true;
+}
+
+void ViewCache::shutdown()
+{
+    if (m_texture) {
+        glDeleteTextures(1, &m_texture);
+        m_texture = 0;
+    }
+    if (m_quadVBO) {
+        glDeleteBuffers(1, &m_quadVBO);
+        m_quadVBO = 0;
+    }
+    if (m_program) {
+        glDeleteProgram(m_program);
+        m_program = 0;
+    }
+    if (m_vertexShader) {
+        glDeleteShader(m_vertexShader);
+        m_vertexShader = 0;
+    }
+    if (m_fragmentShader) {
+        glDeleteShader(m_fragmentShader);
+        m_fragmentShader = 0;
+    }
+    m_texWidth = m_texHeight = 0;
+    m_valid = false;
+    m_initialized = false;
+}
+
+void ViewCache::capture()
+{
+    if (!m_initialized) {
+        return;
+    }
+
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, m_texture);
+    if (viewport[2] != m_texWidth || viewport[3] != m_texHeight) {
+        glCopyTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, viewport[0], viewport[1],
+                         viewport[2], viewport[3], 0);
+        m_texWidth = viewport[2];
+        m_texHeight = viewport[3];
+    } else {
+        glCopyTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, viewport[0], viewport[1],
+                            viewport[2], viewport[3]);
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+    m_valid = true;
+}
+
+bool ViewCache::draw()
+{
+    if (!m_valid) {
+        return false;
+    }
+
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    if (viewport[2] != m_texWidth || viewport[3] != m_texHeight) {
+        return false;
+    }
+
+    glUseProgram(m_program);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, m_texture);
+    glUniform1i(m_textureLoc, 0);
+
+    glBindBuffer(GL_ARRAY_BUFFER, m_quadVBO);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    glDisableVertexAttribArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glUseProgram(0);
+    return true;
+}
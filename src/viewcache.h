@@ -0,0 +1,59 @@
+/*
+ * viewcache.h - Cached copies of rendered frames
+ *
+ * Most redraws of the 3D view (the heartbeat, the torch burning down,
+ * the display refresh task) draw exactly the frame they replace, and
+ * the walls of the scroll map only change with the level.  The Viewer
+ * decides whether its part of the frame has changed; a cache holds the
+ * last one as a texture, copied from the render target right after it
+ * was drawn, and draws it back with one textured quad.
+ *
+ * The copy covers the current viewport, so it works the same for the
+ * window and for the artifact shader's render target.
+ */
+
+#ifndef DOD_VIEWCACHE_HEADER
+#define DOD_VIEWCACHE_HEADER
+
+#include "dod.h"
+
+class ViewCache {
+public:
+    ViewCache();
+    ~ViewCache();
+
+    // Compiles the shader; needs a current GL context
+    bool init();
+    void shutdown();
+
+    // Copies the viewport into the cache
+    void capture();
+
+    // Draws the cached view over the viewport.  False, drawing
+    // nothing, if there is none or it was for another viewport.
+    bool draw();
+
+    // Forgets the cached view (colors or screen size changed)
+    void invalidate() { m_valid = false; }
+
+    bool isInitialized() const { return m_initialized; }
+
+private:
+    GLuint m_program;
+    GLuint m_vertexShader;
+    GLuint m_fragmentShader;
+    GLuint m_texture;
+    GLuint m_quadVBO;
+
+    GLint m_textureLoc;
+
+    int m_texWidth;
+    int m_texHeight;
+    bool m_valid;
+    bool m_initialized;
+};
+
+extern DOD_CONTEXT_LOCAL ViewCache &viewCache; // the 3D view
+extern DOD_CONTEXT_LOCAL ViewCache &mapCache;  // the map's walls and doors
+
+#endif // DOD_VIEWCACHE_HEADER
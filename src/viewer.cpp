@@ -19,95 +19,137 @@ is held by Douglas J. Morgan.
 #include "dodgame.h"
 #include "dungeon.h"
 #include "enhanced.h"
+#include "glyphbatch.h"
 #include "object.h"
 #include "oslink.h"
 #include "parser.h"
+#include "pixelbuf.h"
 #include "player.h"
 #include "sched.h"
 #include "shader.h"
+#include "vecstore.h"
+#include "vectorart.h"
+#include "vectordata.h"
+#include "viewcache.h"
 #include <string>
 
-extern Creature creature;
-extern Dungeon dungeon;
-extern Object object;
-extern Parser parser;
-extern Coordinate crd;
-extern OS_Link oslink;
-extern Player player;
-extern Scheduler scheduler;
-extern dodGame game;
+extern DOD_CONTEXT_LOCAL Creature &creature;
+extern DOD_CONTEXT_LOCAL Dungeon &dungeon;
+extern DOD_CONTEXT_LOCAL Object &object;
+extern DOD_CONTEXT_LOCAL Parser &parser;
+extern DOD_CONTEXT_LOCAL Coordinate &crd;
+extern DOD_CONTEXT_LOCAL OS_Link &oslink;
+extern DOD_CONTEXT_LOCAL Player &player;
+extern DOD_CONTEXT_LOCAL Scheduler &scheduler;
+extern DOD_CONTEXT_LOCAL dodGame &game;
+
+// Vector scale for each view distance, see SETSCL()
+const dodBYTE Viewer::Scale[21] = {
+    0xC8, 0x80, 0x50, 0x32, 0x1F, 0x14, 0x0C, 0x08, 0x04, 0x02, 0xFF, 0x9C,
+    0x64, 0x41, 0x28, 0x1A, 0x10, 0x0A, 0x06, 0x03, 0x01};
+
+// Compressed messages, see OUTSTI()
+const dodBYTE Viewer::enough1[21] = {
+    0xFF, 0xC0, 0x57, 0x3E, 0xA7, 0x46, 0xC0, 0x90, 0x51, 0x32, 0x28, 0x1E,
+    0x60, 0x51, 0x09, 0x98, 0x20, 0xC0, 0xE7, 0xDE, 0xF0};
+const dodBYTE Viewer::enough2[20] = {
+    0xE8, 0x00, 0x08, 0x48, 0xB0, 0x0C, 0x8A, 0x0A, 0x3C, 0x0D, 0x29, 0x68,
+    0x0A, 0x23, 0x20, 0x23, 0xDE, 0xDD, 0xEF, 0x60};
+const dodBYTE Viewer::winner1[21] = {
+    0xFF, 0xC4, 0x54, 0x3D, 0x84, 0xD8, 0x08, 0x59, 0xD1, 0x2E, 0xC8, 0x03,
+    0x70, 0xA6, 0x93, 0x05, 0x10, 0x50, 0x20, 0x2E, 0x20};
+const dodBYTE Viewer::winner2[17] = {
+    0xC8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xCC, 0x00, 0x81, 0xC5, 0xB8, 0x2E,
+    0x9D, 0x06, 0x44, 0xF7, 0xBC};
+const dodBYTE Viewer::death[21] = {
+    0xFF, 0xC1, 0x92, 0xD0, 0x01, 0x73, 0xE8, 0x82, 0xC8, 0x04, 0x79, 0x66,
+    0x07, 0x3E, 0x80, 0x91, 0x69, 0x59, 0x3B, 0xDE, 0xF0};
+const dodBYTE Viewer::copyright[21] = {
+    0xF8, 0xDF, 0x0C, 0xC9, 0x27, 0x45, 0x00, 0x02, 0x65, 0xC1, 0x03, 0x52,
+    0x39, 0x3C, 0x00, 0x68, 0xDA, 0xCC, 0x63, 0x09, 0x48};
+const dodBYTE Viewer::welcome1[14] = {
+    0x9F, 0xD2, 0x02, 0x06, 0x45, 0x06, 0x4A, 0x02, 0xBA, 0x85, 0x97, 0xBD,
+    0xEF, 0x80};
+const dodBYTE Viewer::welcome2[20] = {
+    0xF7, 0xBD, 0xEA, 0x20, 0xA0, 0x25, 0x5C, 0x72, 0xBD, 0xD3, 0x03, 0xCC,
+    0x02, 0x04, 0xE7, 0x7C, 0x83, 0x44, 0x6F, 0x7B};
+const dodBYTE Viewer::prepstr[6] = {0x3C, 0x24, 0x58, 0x06, 0x45, 0xD8};
+const dodBYTE Viewer::exam1[9] = {
+    0x62, 0x5C, 0x0A, 0x21, 0x33, 0x04, 0x9E, 0xF6, 0xFC};
+const dodBYTE Viewer::exam2[8] = {
+    0x56, 0xC7, 0x22, 0x86, 0x95, 0x91, 0x77, 0xF0};
+const dodBYTE Viewer::exam3[7] = {0x40, 0x82, 0x35, 0xC0, 0x23, 0x5F, 0xC0};
+const dodBYTE Viewer::exps[3] = {0x16, 0xF7, 0xB0};
 
 // Constructor
 Viewer::Viewer()
-    : VCNTRX(128), VCNTRY(76), fadChannel(3), buzzStep(300), midPause(2500),
-      prepPause(2500), currentFadeMode(0), fadeInterrupted(false),
-      fadeStartTime(0), fadeNextFrameTime(0), batchingLines(false) {
-  Utils::LoadFromDecDigit(A_VLA, "411212717516167572757582823535424");
-  Utils::LoadFromDecDigit(B_VLA,
-                          "6112128182151522224545525275758285262645455656757");
-  Utils::LoadFromDecDigit(C_VLA, "51222271721515222275758285262635356666757");
-  Utils::LoadFromDecDigit(D_VLA, "411515212175758181222271752626757");
-  Utils::LoadFromDecDigit(E_VLA, "411212818245455252767682821616222");
-  Utils::LoadFromDecDigit(F_VLA, "3112128182454552527676828");
-  Utils::LoadFromDecDigit(G_VLA,
-                          "6122227172767682856666757216162225262635343636444");
-  Utils::LoadFromDecDigit(H_VLA, "3112128185161685824545525");
-  Utils::LoadFromDecDigit(I_VLA, "3215152222757582832424737");
-  Utils::LoadFromDecDigit(J_VLA, "3122223132151522252626858");
-  Utils::LoadFromDecDigit(
-      K_VLA,
-      "81121281824343525354546364656574757676858516162524252534333434434");
-  Utils::LoadFromDecDigit(L_VLA, "21121281821616222");
-  Utils::LoadFromDecDigit(M_VLA, "51121281851616858263637274656574733434636");
-  Utils::LoadFromDecDigit(N_VLA, "51121281851616858253536263444453543535444");
-  Utils::LoadFromDecDigit(O_VLA, "412222717526267572151522227575828");
-  Utils::LoadFromDecDigit(P_VLA, "411212818245455255565675727575828");
-  Utils::LoadFromDecDigit(
-      Q_VLA, "712222717214142222757582833434434425253435161625253636757");
-  Utils::LoadFromDecDigit(
-      R_VLA, "711212818275758282454552555656757334344344252534351616252");
-  Utils::LoadFromDecDigit(
-      S_VLA, "712222313566667572151522224545525275758281525271752626454");
-  Utils::LoadFromDecDigit(T_VLA, "416262818566668582757582831414737");
-  Utils::LoadFromDecDigit(U_VLA, "3122228185262685821515222");
-  Utils::LoadFromDecDigit(V_VLA, "51525281855656858233335254353554531414333");
-  Utils::LoadFromDecDigit(W_VLA, "51121281851616858223233234252534333434535");
-  Utils::LoadFromDecDigit(X_VLA, "911212313516163531626281856666858233334244353"
-                                 "5444344445352535362645555646");
-  Utils::LoadFromDecDigit(Y_VLA, "53141453525353626455556461626281856666858");
-  Utils::LoadFromDecDigit(
-      Z_VLA, "711616212176768181222231323333424344445354555564656666757");
-  Utils::LoadFromDecDigit(NM0_VLA, "422323727373858575767625231515232");
-  Utils::LoadFromDecDigit(NM1_VLA, "3316162324252584836464737");
-  Utils::LoadFromDecDigit(NM2_VLA,
-                          "6116162121222241424545525556567575758282716262717");
-  Utils::LoadFromDecDigit(
-      NM3_VLA, "721515222122223135262645454552524556567575758282727261617");
-  Utils::LoadFromDecDigit(NM4_VLA, "441515848646515142535362636464737");
-  Utils::LoadFromDecDigit(NM5_VLA,
-                          "6122223132151522252626555555616151626271717676818");
-  Utils::LoadFromDecDigit(NM6_VLA, "52151522252626454122227172454552527575828");
-  Utils::LoadFromDecDigit(NM7_VLA,
-                          "6112123132333342434444535455556465666675717676818");
-  Utils::LoadFromDecDigit(
-      NM8_VLA, "721515222122224145262645424545525152527175565675727575828");
-  Utils::LoadFromDecDigit(NM9_VLA,
-                          "6114142124252534353636757245455251525271727575828");
-  Utils::LoadFromDecDigit(PER_VLA, "131414232");
-  Utils::LoadFromDecDigit(UND_VLA, "111616212");
-  Utils::LoadFromDecDigit(EXP_VLA, "23141423234444838");
-  Utils::LoadFromDecDigit(QSM_VLA,
-                          "6314142323343453544545545556567571626271727575828");
-  Utils::LoadFromDecDigit(SHL_VLA, "174848676");
-  Utils::LoadFromDecDigit(SHR_VLA, "403131707233337271222261634444636");
-  Utils::LoadFromDecDigit(LHL_VLA, "26474766673838777");
-  Utils::LoadFromDecDigit(LHR_VLA, "50212170711212616223237273343473744545646");
-  Utils::LoadFromDecDigit(FSL_VLA, "51121231323333424344445354555564656666858");
-  Utils::LoadFromDecDigit(BSL_VLA, "51626281825353626344445354353544451616353");
-  Utils::LoadFromDecDigit(
-      PCT_VLA, "711212313233334243444453545555646566668581636381841616343");
-  Utils::LoadFromDecDigit(PLS_VLA, "23242473714646515");
-  Utils::LoadFromDecDigit(DSH_VLA, "114646515");
+    : deferDraw(false), VCNTRX(128), VCNTRY(76), fadChannel(3), buzzStep(300),
+      midPause(2500), prepPause(2500), currentFadeMode(0),
+      fadeInterrupted(false), fadeStartTime(0), fadeNextFrameTime(0),
+      scaleIdx(-1), recordView(false), lastViewOptions(0),
+      mapMarkDoors(false) {
+  setVectorLists(VectorData::lists);
+
+  TXTEXA.SetVals(examArea, 0, 32 * 19, 0);
+  TXTPRI.SetVals(textArea, 0, 32 * 4, 20);
+  TXTSTS.SetVals(statArea, 0, 32 * 1, 19);
+
+  FLATAB[0] = 3;
+  FLATAB[1] = 0;
+  FLATAB[2] = 1;
+
+  FLATABv[0] = LArch;
+  FLATABv[1] = FArch;
+  FLATABv[2] = RArch;
+
+  float start1 = 200.0f;
+  float start2 = 256.0f;
+  for (int x = 0; x < 9; x++) {
+    Scalef[x] = start1;
+    Scalef[x + 10] = start2;
+    start1 *= 0.633f;
+    start2 *= 0.633f;
+  }
+  Scalef[20] = start2;
+
+  Reset();
+}
+
+// The Viewer's vector list pointers, by VectorData id
+static const dodBYTE *Viewer::*const listMembers[VectorData::LIST_COUNT] = {
+    &Viewer::A_VLA, &Viewer::B_VLA, &Viewer::C_VLA, &Viewer::D_VLA,
+    &Viewer::E_VLA, &Viewer::F_VLA, &Viewer::G_VLA, &Viewer::H_VLA,
+    &Viewer::I_VLA, &Viewer::J_VLA, &Viewer::K_VLA, &Viewer::L_VLA,
+    &Viewer::M_VLA, &Viewer::N_VLA, &Viewer::O_VLA, &Viewer::P_VLA,
+    &Viewer::Q_VLA, &Viewer::R_VLA, &Viewer::S_VLA, &Viewer::T_VLA,
+    &Viewer::U_VLA, &Viewer::V_VLA, &Viewer::W_VLA, &Viewer::X_VLA,
+    &Viewer::Y_VLA, &Viewer::Z_VLA, &Viewer::NM0_VLA, &Viewer::NM1_VLA,
+    &Viewer::NM2_VLA, &Viewer::NM3_VLA, &Viewer::NM4_VLA, &Viewer::NM5_VLA,
+    &Viewer::NM6_VLA, &Viewer::NM7_VLA, &Viewer::NM8_VLA, &Viewer::NM9_VLA,
+    &Viewer::PER_VLA, &Viewer::UND_VLA, &Viewer::EXP_VLA, &Viewer::QSM_VLA,
+    &Viewer::SHL_VLA, &Viewer::SHR_VLA, &Viewer::LHL_VLA, &Viewer::LHR_VLA,
+    &Viewer::FSL_VLA, &Viewer::BSL_VLA, &Viewer::PCT_VLA, &Viewer::PLS_VLA,
+    &Viewer::DSH_VLA, &Viewer::SP_VLA, &Viewer::WR_VLA, &Viewer::SC_VLA,
+    &Viewer::BL_VLA, &Viewer::GL_VLA, &Viewer::VI_VLA, &Viewer::S1_VLA,
+    &Viewer::S2_VLA, &Viewer::K1_VLA, &Viewer::K2_VLA, &Viewer::W0_VLA,
+    &Viewer::W1_VLA, &Viewer::W2_VLA, &Viewer::LAD_VLA, &Viewer::HUP_VLA,
+    &Viewer::HDN_VLA, &Viewer::CEI_VLA, &Viewer::LPK_VLA, &Viewer::RPK_VLA,
+    &Viewer::FSD_VLA, &Viewer::LSD_VLA, &Viewer::RSD_VLA,
+    &Viewer::RWAL_VLA, &Viewer::LWAL_VLA, &Viewer::FWAL_VLA,
+    &Viewer::RPAS_VLA, &Viewer::LPAS_VLA, &Viewer::FPAS_VLA,
+    &Viewer::RDOR_VLA, &Viewer::LDOR_VLA, &Viewer::FDOR_VLA,
+    &Viewer::SHIE_VLA, &Viewer::SWOR_VLA, &Viewer::TORC_VLA,
+    &Viewer::RING_VLA, &Viewer::SCRO_VLA, &Viewer::FLAS_VLA,
+    &Viewer::LINES};
+
+// Points the vector lists, and the tables built from them, at
+// "lists".  Must come before storeVectorLists() and storeGlyphs().
+void Viewer::setVectorLists(const dodBYTE *const lists[]) {
+  for (int id = 0; id < VectorData::LIST_COUNT; ++id) {
+    this->*listMembers[id] = lists[id];
+  }
+  scaledLists.clear();
+  lastViewCmds.clear();
 
   AZ_VLA[1] = A_VLA;
   AZ_VLA[2] = B_VLA;
@@ -159,119 +201,6 @@ Viewer::Viewer()
   AZ_VLA[48] = PLS_VLA;
   AZ_VLA[49] = DSH_VLA;
 
-  Utils::LoadFromHex(
-      SP_VLA,
-      "020BA07CA474A878B074B878B07CA878B078B878BC74C07C07A87CAA74AC78B07AB478"
-      "B674B87C");
-
-  Utils::LoadFromHex(
-      WR_VLA,
-      "0303443E58446438095A4A4A46504C5A4A644866405A4A5E565A56075064565A645C6C"
-      "62625E565E5064");
-
-  Utils::LoadFromHex(
-      SC_VLA,
-      "020D4A704A6C46683E6C42744A765278527C4A7C427446783E78427C065A7C5A785278"
-      "4A7C4A805280");
-  Utils::LoadFromHex(
-      BL_VLA,
-      "0314825272566C646A6E6A7860826A806884727E80808E82948098849A80A2829C7C9A"
-      "6C945C8A568252088256885C8A6280648256785C7666806403746C76729078");
-  Utils::LoadFromHex(
-      GL_VLA,
-      "04157C50725E786E70844E6830844844205458167234805C8E34A816E058B844D084B2"
-      "709084886E8E5E84500970847A7C7E6E7A64805C8664826E867C90840B7A526A605C5C"
-      "564C4E48544E4C4E54525860666874641BA816A21AA612A018A01E96268C2E862A8A20"
-      "8412862080267A207C1276207A2A8036862A802E7A2A742E6A26601E60185A125E1A581"
-      "6");
-  Utils::LoadFromHex(
-      VI_VLA,
-      "020F82847A707C5C7E5E825E845C82708C80888472846C78766A7078747C7E7C107864"
-      "78607C5C785878547A527E567A5286528256865288548858845C88608864");
-  Utils::LoadFromHex(
-      S1_VLA,
-      "050A62687062785C805E846084667E6878687266646A0C846688669470A07AAE7CAA78"
-      "AE78A274986A8E60825C7658085C4E604662505E565C4E544C58545E560B5A6A566C58"
-      "6E5E6C6278547E587A507A58764C6650621554565C60666C627056684A5E4C52544C50"
-      "48544A58445E46604260466C44744878566860645C6E546A4A");
-  Utils::LoadFromHex(
-      S2_VLA,
-      "050462687C5E7E60646A108466725C7666726E846688669470A07AAE7CAA78AE78A274"
-      "986A8E60825C7658085C4E604662505E565C4E544C58545E560B5A6A566C586E5E6C62"
-      "78547E587A507A58764C6650621554565C60666C627056684A5E4C52544C5048544A58"
-      "445E46604260466C44744878566860645C6E546A4A");
-  Utils::LoadFromHex(
-      K1_VLA,
-      "08057C22842282247E247C22088E508840922E9C408C52884C92408C3A068C509880A0"
-      "849084907E8254067E546E7E6E845C8466807450118C50805672507840743A6E2E7A2A"
-      "7C1E801A841E862A922E862A862E80347A2E7A2A07803480147C147E18821884148014"
-      "0E664A66466A466A405A405A465E465E4A604A60506450644A664A743A096E2E664064"
-      "40661E62145E1E604062406214");
-  Utils::LoadFromHex(
-      K2_VLA,
-      "08047E1E7E287C287C2407962CA634A44C965C884C8634962C068C509880A084908490"
-      "7E8254067E546E7E6E845C8466807450118C50805672507840743A6E2E7A2A7C1E801A"
-      "841E862A922E862A862E80347A2E7A2A07803480147C147E188218841480140E664A66"
-      "466A466A405A405A465E465E4A604A60506450644A664A743A096E2E66406440661E62"
-      "145E1E604062406214");
-  Utils::LoadFromHex(
-      W0_VLA,
-      "080D7C40784878406E4E66406E3A763678327A2E74286C2A781C7E1C08821C881C9224"
-      "9432882C842E8630882C0986308E36A474848476825E786E5A84846A4805664064425E"
-      "38603666400566426244664A684C6E5A027058784809843E80147A347A407C3C807282"
-      "508244843E0B822880267C287E2A8228802E80327E327E2A7C287E2E");
-  Utils::LoadFromHex(
-      W1_VLA,
-      "0A0D7C40784878406E4E66406E3A763678327A2E74286C2A781C7E1C08821C881C9224"
-      "9432882C842E8630882C0986308E36A474848476825E786E5A84846A4805664064425E"
-      "38603666400566426244664A684C6E5A027058784809843E80147A347A407C3C807282"
-      "508244843E0B822880267C287E2A8228802E80327E327E2A7C287E2E10622E64326236"
-      "5C3A5638523056285A265E285C28582A563058345C366232622E109A689C6C9A709474"
-      "8E728A6A8E6292609662946290648E6A926E96709A6C9A68");
-  Utils::LoadFromHex(
-      W2_VLA,
-      "0C0D7C40784878406E4E66406E3A763678327A2E74286C2A781C7E1C08821C881C9224"
-      "9432882C842E8630882C0986308E36A474848476825E786E5A84846A4805664064425E"
-      "38603666400566426244664A684C6E5A027058784809843E80147A347A407C3C807282"
-      "508244843E0B822880267C287E2A8228802E80327E327E2A7C287E2E0656285C40642A"
-      "523668385628068C428C508644904A864C8C42069260947888649A6A8A749260067450"
-      "7A5A72567A52745A7450");
-  Utils::LoadFromHex(
-      LAD_VLA,
-      "0B0274187480028C188C8002741C8C1C0274288C280274348C340274408C4002744C8C"
-      "4C0274588C580274648C640274708C7002747B8C7B");
-  Utils::LoadFromHex(
-      HUP_VLA, "040664225C18A4189C2264226418029C229C18022F1C601C02A11CD21C");
-  Utils::LoadFromHex(HDN_VLA, "020664765C80A4809C7664766480029C769C80");
-  Utils::LoadFromHex(CEI_VLA, "01022F1CD11C");
-  Utils::LoadFromHex(LPK_VLA, "01051C64246C207024781C80");
-  Utils::LoadFromHex(RPK_VLA, "0105E464DC6CE070DC78E480");
-  Utils::LoadFromHex(FSD_VLA, "01036C7180439472");
-  Utils::LoadFromHex(LSD_VLA, "0103288032423A75");
-  Utils::LoadFromHex(RSD_VLA, "0103D880CE42C675");
-  Utils::LoadFromHex(RWAL_VLA, "0104E510C026C072E588");
-  Utils::LoadFromHex(LWAL_VLA, "01041B10402640721B88");
-  Utils::LoadFromHex(FWAL_VLA, "02024026C026024072C072");
-  Utils::LoadFromHex(RPAS_VLA, "0204E526C026C072E57202E510C026");
-  Utils::LoadFromHex(LPAS_VLA, "02041D26402640721B72021B104026");
-  Utils::LoadFromHex(FPAS_VLA, "00");
-  Utils::LoadFromHex(RDOR_VLA,
-                     "0304E510C026C072E58804D880D841C844C87702D05CCC5D");
-  Utils::LoadFromHex(LDOR_VLA,
-                     "03041B10402640721B8804288028413844387702305C345D");
-  Utils::LoadFromHex(FDOR_VLA,
-                     "04024026C026024072C072046C726C4394439472027E5E825E");
-  Utils::LoadFromHex(SHIE_VLA, "0106AC86C080BA7AA880A486AC86");
-  Utils::LoadFromHex(SWOR_VLA, "02025072647C0252765672");
-  Utils::LoadFromHex(TORC_VLA, "01043C764A7448723C76");
-  Utils::LoadFromHex(RING_VLA, "01053C7A3E7C3C7E3A7C3C7A");
-  Utils::LoadFromHex(SCRO_VLA, "0105C276C078C87ECA7CC276");
-  Utils::LoadFromHex(FLAS_VLA, "0104A26EA478A078A26E");
-
-  TXTEXA.SetVals(examArea, 0, 32 * 19, 0);
-  TXTPRI.SetVals(textArea, 0, 32 * 4, 20);
-  TXTSTS.SetVals(statArea, 0, 32 * 1, 19);
-
   LArch[0] = LPAS_VLA;
   LArch[1] = LDOR_VLA;
   LArch[2] = LSD_VLA;
@@ -287,14 +216,6 @@ Viewer::Viewer()
   RArch[2] = RSD_VLA;
   RArch[3] = RWAL_VLA;
 
-  FLATAB[0] = 3;
-  FLATAB[1] = 0;
-  FLATAB[2] = 1;
-
-  FLATABv[0] = LArch;
-  FLATABv[1] = FArch;
-  FLATABv[2] = RArch;
-
   FWDOBJ[0] = FLAS_VLA;
   FWDOBJ[1] = RING_VLA;
   FWDOBJ[2] = SCRO_VLA;
@@ -314,34 +235,21 @@ Viewer::Viewer()
   FWDCRE[9] = GL_VLA;
   FWDCRE[10] = W0_VLA;
   FWDCRE[11] = W1_VLA;
+}
 
-  float start1 = 200.0f;
-  float start2 = 256.0f;
-  for (int x = 0; x < 9; x++) {
-    Scalef[x] = start1;
-    Scalef[x + 10] = start2;
-    start1 *= 0.633f;
-    start2 *= 0.633f;
+// Loads vector art file "fn" over the built-in lists, see
+// vectorart.h.  A file that fails to load changes nothing.
+bool Viewer::loadVectorArt(const char *fn) {
+  std::vector<unsigned char> art;
+  const dodBYTE *lists[VectorData::LIST_COUNT];
+  memcpy(lists, VectorData::lists, sizeof(lists));
+  if (!VectorArt::load(fn, art, lists)) {
+    fprintf(stderr, "Cannot load vector art %s\n", fn);
+    return false;
   }
-  Scalef[20] = start2;
-
-  Utils::LoadFromHex(Scale, "C88050321F140C080402FF9C6441281A100A060301");
-  Utils::LoadFromHex(enough1, "FFC0573EA746C0905132281E6051099820C0E7DEF0");
-  Utils::LoadFromHex(enough2, "E8000848B00C8A0A3C0D29680A232023DEDDEF60");
-  Utils::LoadFromHex(winner1, "FFC4543D84D80859D12EC80370A693051050202E20");
-  Utils::LoadFromHex(winner2, "C80000000003CC0081C5B82E9D0644F7BC");
-  Utils::LoadFromHex(death, "FFC192D00173E882C8047966073E809169593BDEF0");
-  Utils::LoadFromHex(copyright, "F8DF0CC92745000265C10352393C0068DACC630948");
-  Utils::LoadFromHex(welcome1, "9FD2020645064A02BA8597BDEF80");
-  Utils::LoadFromHex(welcome2, "F7BDEA20A0255C72BDD303CC0204E77C83446F7B");
-  Utils::LoadFromHex(prepstr, "3C24580645D8");
-  Utils::LoadFromHex(exam1, "625C0A2133049EF6FC");
-  Utils::LoadFromHex(exam2, "56C72286959177F0");
-  Utils::LoadFromHex(exam3, "408235C0235FC0");
-  Utils::LoadFromHex(exps, "16F7B0");
-  Utils::LoadFromHex(LINES, "02020010FF10020088FF88");
-
-  Reset();
+  vectorArt.swap(art); // the lists point into the buffer, not the vector
+  setVectorLists(lists);
+  return true;
 }
 
 void Viewer::Reset() {
@@ -385,6 +293,8 @@ void Viewer::setup_opengl() {
   glMatrixMode(GL_PROJECTION);
   glLoadIdentity();
   glOrtho(0, oslink.width, 0, oslink.height, -1, 1);
+  viewCache.invalidate(); // screen size may have changed
+  mapCache.invalidate();
 }
 
 void Viewer::setVidInv(bool inv) {
@@ -408,6 +318,17 @@ void Viewer::setVidInv(bool inv) {
     fgColor[2] = 0.0;
   }
   glClearColor(bgColor[0], bgColor[1], bgColor[2], 0.0);
+
+  viewCache.invalidate();
+
+  // Line colors for every VCTFAD, between FG and BG
+  for (int fade = 0; fade < 256; ++fade) {
+    float flBrightness = 1.0f / (fade / 2.0f + 1.0f);
+    for (int ctr = 0; ctr < 3; ++ctr) {
+      fadeColors[fade][ctr] =
+          fgColor[ctr] * flBrightness + bgColor[ctr] * (1.0f - flBrightness);
+    }
+  }
 }
 
 // This is the main renderer routine.  It draws either
@@ -416,6 +337,7 @@ void Viewer::draw_game() {
   if (UPDATE == 0) {
     return;
   }
+  TraceScope draw(oslink.tracer, "draw_game", "render");
 
   // Check if artifact color mode is enabled and shader is ready
   bool useArtifact = (g_options & OPT_ARTIFACT) && shaderMgr.isInitialized();
@@ -440,7 +362,7 @@ void Viewer::draw_game() {
     glColor3fv(fgColor);
     switch (display_mode) {
     case MODE_3D:
-      VIEWER();
+      drawView();
       break;
     case MODE_EXAMINE:
       clearArea(&TXTEXA);
@@ -464,13 +386,21 @@ void Viewer::draw_game() {
     drawArea(&TXTPRI);
   }
 
-  // Apply artifact effect if enabled, then swap buffers
+  // Draw the queued lines, apply artifact effect if
+  // enabled, then swap buffers
+  flushLines();
+  pixelBuf.flush(fgColor);
   if (useArtifact) {
     shaderMgr.endRenderToTexture();
-    shaderMgr.applyArtifactEffect((g_options & OPT_ARTIFACT_FLIP) != 0);
+    shaderMgr.applyArtifactEffect((g_options & OPT_ARTIFACT_FLIP) != 0,
+                                  (g_options & OPT_SCANLINES) != 0,
+                                  (g_options & OPT_PHOSPHOR) != 0);
   }
 
-  SDL_GL_SwapWindow(oslink.sdlWindow);
+  {
+    TraceScope swap(oslink.tracer, "SwapWindow", "render");
+    SDL_GL_SwapWindow(oslink.sdlWindow);
+  }
   UPDATE = 0;
 }
 
@@ -486,11 +416,16 @@ void Viewer::beginFrame() {
 // Helper function to end a frame, applying artifact effect if enabled and swapping buffers
 // Call this instead of SDL_GL_SwapWindow for consistent artifact color support
 void Viewer::endFrame() {
+  flushLines();
+  pixelBuf.flush(fgColor);
   bool useArtifact = (g_options & OPT_ARTIFACT) && shaderMgr.isInitialized();
   if (useArtifact) {
     shaderMgr.endRenderToTexture();
-    shaderMgr.applyArtifactEffect((g_options & OPT_ARTIFACT_FLIP) != 0);
+    shaderMgr.applyArtifactEffect((g_options & OPT_ARTIFACT_FLIP) != 0,
+                                  (g_options & OPT_SCANLINES) != 0,
+                                  (g_options & OPT_PHOSPHOR) != 0);
   }
+  TraceScope swap(oslink.tracer, "SwapWindow", "render");
   SDL_GL_SwapWindow(oslink.sdlWindow);
 }
 
@@ -498,7 +433,7 @@ void Viewer::endFrame() {
 // Note: With double-buffering, we must redraw the full scene because the back
 // buffer doesn't retain the previous frame's content. A partial scissored draw
 // would leave the text area blank after swap.
-// Future optimization: cache 3D scene to FBO/texture to avoid VIEWER() recomputation.
+// An unchanged 3D view is redrawn from the view cache (see drawView()).
 void Viewer::draw_status_line() {
   if (UPDATE == 0) {
     UPDATE = 1;
@@ -510,7 +445,7 @@ void Viewer::draw_status_line() {
 void Viewer::initFade(int fadeMode) {
   currentFadeMode = fadeMode;
   fadeInterrupted = false;
-  fadeStartTime = SDL_GetTicks();
+  fadeStartTime = DOD_GetTicks();
   fadeNextFrameTime = fadeStartTime;
 
   VXSCAL = 0x80;
@@ -558,8 +493,8 @@ void Viewer::initFade(int fadeMode) {
 // Non-blocking fade update - call each frame
 // Returns true when fade is complete
 bool Viewer::updateFade() {
-  Uint32 now = SDL_GetTicks();
-  int *wiz = (currentFadeMode == FADE_VICTORY) ? W2_VLA : W1_VLA;
+  Uint32 now = DOD_GetTicks();
+  const dodBYTE *wiz = (currentFadeMode == FADE_VICTORY) ? W2_VLA : W1_VLA;
 
   // Check for key press to skip fade (only for FADE_BEGIN)
   if (currentFadeMode == FADE_BEGIN && scheduler.keyCheck()) {
@@ -644,7 +579,7 @@ bool Viewer::updateFade() {
 //   3 = Death
 //   4 = Victory
 bool Viewer::ShowFade(int fadeMode, bool inMainLoop) {
-#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_ASYNCIFY__)
+#if defined(DOD_NONBLOCKING)
   // Without ASYNCIFY, blocking fades don't work - just display message and return
   (void)inMainLoop;
   clearArea(&TXTPRI);
@@ -675,7 +610,7 @@ bool Viewer::ShowFade(int fadeMode, bool inMainLoop) {
   //    std::cout << "in showfade" << std::endl;
   Uint32 ticks1, ticks2;
   SDL_Event event;
-  int *wiz;
+  const dodBYTE *wiz;
   VXSCAL = 0x80;
   VYSCAL = 0x80;
 
@@ -734,9 +669,9 @@ bool Viewer::ShowFade(int fadeMode, bool inMainLoop) {
     glLoadIdentity();
     drawVectorList(wiz);
     endFrame();
-    ticks1 = SDL_GetTicks();
+    ticks1 = DOD_GetTicks();
     do {
-      ticks2 = SDL_GetTicks();
+      ticks2 = DOD_GetTicks();
       if (fadeMode == 1 && scheduler.keyCheck()) {
         Mix_HaltChannel(fadChannel);
         clearArea(&TXTPRI);
@@ -786,9 +721,9 @@ bool Viewer::ShowFade(int fadeMode, bool inMainLoop) {
   //    std::cout << "after swapwindow" << std::endl;
   if (fadeMode < 3) {
     // pause with wiz, status, and message
-    ticks1 = SDL_GetTicks();
+    ticks1 = DOD_GetTicks();
     do {
-      ticks2 = SDL_GetTicks();
+      ticks2 = DOD_GetTicks();
 
       beginFrame();
       glClear(GL_COLOR_BUFFER_BIT);
@@ -857,9 +792,9 @@ bool Viewer::ShowFade(int fadeMode, bool inMainLoop) {
       drawVectorList(wiz);
       endFrame();
 
-      ticks1 = SDL_GetTicks();
+      ticks1 = DOD_GetTicks();
       do {
-        ticks2 = SDL_GetTicks();
+        ticks2 = DOD_GetTicks();
         if (fadeMode != 2 && scheduler.keyCheck()) {
           Mix_HaltChannel(fadChannel);
           clearArea(&TXTPRI);
@@ -909,7 +844,7 @@ bool Viewer::ShowFade(int fadeMode, bool inMainLoop) {
 // is syncronized with the 30Hz buzz and the wizard
 // crashing sound.
 bool Viewer::draw_fade() {
-  delay1 = delay2 = SDL_GetTicks();
+  delay1 = delay2 = DOD_GetTicks();
 
   if ((!done && delay1 > delay + buzzStep) && fadeVal != 0) {
     // Set volume of buzz
@@ -945,7 +880,7 @@ bool Viewer::draw_fade() {
       clearArea(&TXTPRI);
       drawArea(&TXTPRI);
     }
-    delay = SDL_GetTicks();
+    delay = DOD_GetTicks();
   }
 
   if (VCTFAD == 0 && fadeVal == 0) {
@@ -959,28 +894,28 @@ bool Viewer::draw_fade() {
     drawArea(&TXTPRI);
     endFrame();
 
-    delay2 = SDL_GetTicks();
+    delay2 = DOD_GetTicks();
     if (delay2 > delay + midPause) {
       // do sound crash
       Mix_PlayChannel(fadChannel, creature.kaboom, 0);
       scheduler.WaitForChannel(fadChannel);
 
       fadeVal = 2;
-      delay = SDL_GetTicks();
+      delay = DOD_GetTicks();
 
       Mix_PlayChannel(fadChannel, creature.buzz, -1);
     }
   }
 
   if (!done) {
-    delay1 = delay2 = SDL_GetTicks();
+    delay1 = delay2 = DOD_GetTicks();
   }
   return done;
 }
 
 // Same as above, but used for the intermission
 void Viewer::enough_fade() {
-  delay1 = delay2 = SDL_GetTicks();
+  delay1 = delay2 = DOD_GetTicks();
 
   if ((!done && delay1 > delay + buzzStep) && fadeVal != 0) {
     // Set volume of buzz
@@ -1027,7 +962,7 @@ void Viewer::enough_fade() {
       clearArea(&TXTPRI);
       drawArea(&TXTPRI);
     }
-    delay = SDL_GetTicks();
+    delay = DOD_GetTicks();
   }
 
   if (VCTFAD == 0 && fadeVal == 0) {
@@ -1042,27 +977,27 @@ void Viewer::enough_fade() {
     drawArea(&TXTPRI);
     endFrame();
 
-    delay2 = SDL_GetTicks();
+    delay2 = DOD_GetTicks();
     if (delay2 > delay + midPause) {
       // do sound crash
       Mix_PlayChannel(fadChannel, creature.kaboom, 0);
       scheduler.WaitForChannel(fadChannel);
 
       fadeVal = 2;
-      delay = SDL_GetTicks();
+      delay = DOD_GetTicks();
 
       Mix_PlayChannel(fadChannel, creature.buzz, -1);
     }
   }
 
   if (!done) {
-    delay1 = delay2 = SDL_GetTicks();
+    delay1 = delay2 = DOD_GetTicks();
   }
 }
 
 // Same as above, but used for death & victory
-void Viewer::death_fade(int WIZ[]) {
-  delay1 = SDL_GetTicks();
+void Viewer::death_fade(const dodBYTE WIZ[]) {
+  delay1 = DOD_GetTicks();
 
   if ((delay1 > delay + buzzStep) && fadeVal != 0) {
     // Set volume of buzz
@@ -1105,7 +1040,7 @@ void Viewer::death_fade(int WIZ[]) {
       fadeVal = 0;
       done = true;
     }
-    delay = SDL_GetTicks();
+    delay = DOD_GetTicks();
   }
 
   if (fadeVal == 0) {
@@ -1170,11 +1105,14 @@ void Viewer::drawTorchHighlite() {
   glEnd();
   glColor3fv(bgColor);
   object.OBJNAM(player.PTORCH);
-  drawString_internal(x1, y1, parser.TOKEN, tlen);
+  drawString_internal(x1, y1, parser.TOKEN, tlen, bgColor);
 }
 
 void Viewer::drawArea(TXB *a) {
   int cnt = 0;
+  GLfloat *textColor = (a->top == 19) ? bgColor : fgColor;
+
+  flushLines(); // the area is drawn over any lines
 
   if (a->top == 19) {
     glLoadIdentity();
@@ -1198,10 +1136,18 @@ void Viewer::drawArea(TXB *a) {
     glColor3fv(fgColor);
   }
 
+  // One row of 32 characters per line; the whole area is a
+  // single draw when the glyph batch is available
   while (cnt < a->len) {
-    drawString(0, a->top + cnt / 32, a->area + cnt);
+    int rowLen = (a->len - cnt < 32) ? a->len - cnt : 32;
+    if (glyphBatch.isInitialized()) {
+      glyphBatch.add(0, a->top + cnt / 32, a->area + cnt, rowLen);
+    } else {
+      drawString(0, a->top + cnt / 32, std::string(a->area + cnt, rowLen));
+    }
     cnt += 32;
   }
+  glyphBatch.draw(textColor);
 }
 
 void Viewer::clearArea(TXB *a) {
@@ -1231,7 +1177,9 @@ int Viewer::LUKNEW() {
   return 0;
 }
 
-// Updates the screen.
+// Updates the screen.  During a scheduler pass this only
+// invalidates the view; OS_Link::render() presents it once
+// after SCHED() returns, however many tasks asked for it.
 void Viewer::PUPDAT() {
   if (player.FAINT != 0) {
     return;
@@ -1240,7 +1188,9 @@ void Viewer::PUPDAT() {
   PUPSUB();
 
   --UPDATE;
-  draw_game();
+  if (!deferDraw) {
+    draw_game();
+  }
 }
 
 // Sets lighting values.
@@ -1296,7 +1246,7 @@ void Viewer::STATUS() {
   }
 }
 
-void Viewer::OUTSTI(dodBYTE *comp) {
+void Viewer::OUTSTI(const dodBYTE *comp) {
   int c;
   parser.EXPAND(comp, &c, 0);
   OUTSTR(&parser.STRING[1]);
@@ -1485,16 +1435,13 @@ void Viewer::VIEWER() {
     }
 
     // Draw Objects
-    object.OFINDF = 0;
-    do {
-      objIdx = object.OFIND(dungeon.DROW);
-      if (objIdx == -1)
-        break;
+    for (objIdx = object.NextInCell(dungeon.DROW, -1); objIdx != -1;
+         objIdx = object.NextInCell(dungeon.DROW, objIdx)) {
       --MAGFLG;
       DRAWIT(FWDOBJ[object.OCBLND[objIdx].obj_type]);
       DRAWIT(FWDOBJ[object.OCBLND[objIdx].obj_type]);
       // Need to yield?
-    } while (true);
+    }
 
     if (dungeon.NEIBOR[u] != 0) {
       break;
@@ -1506,6 +1453,42 @@ void Viewer::VIEWER() {
   } while (RANGE <= 9);
 }
 
+// Draws the 3D view.  VIEWER() first only records what it would
+// draw; when that is what the cached view shows, with the same
+// drawing options, the cached copy is drawn instead.
+void Viewer::drawView() {
+  if (!viewCache.isInitialized()) {
+    VIEWER();
+    return;
+  }
+
+  recordView = true;
+  viewCmds.clear();
+  VIEWER();
+  recordView = false;
+
+  int options = g_options & (OPT_VECTOR | OPT_HIRES);
+  if (viewCmds == lastViewCmds && options == lastViewOptions &&
+      viewCache.draw()) {
+    return;
+  }
+
+  for (size_t ctr = 0; ctr < viewCmds.size(); ++ctr) {
+    const ViewCmd &cmd = viewCmds[ctr];
+    VXSCALf = cmd.scaleX;
+    VYSCALf = cmd.scaleY;
+    scaleIdx = cmd.scale;
+    VCTFAD = cmd.fade;
+    drawVectorList(cmd.vl);
+  }
+  flushLines();
+  pixelBuf.flush(fgColor);
+  viewCache.capture();
+
+  lastViewCmds.swap(viewCmds);
+  lastViewOptions = options;
+}
+
 // Calculates fade (line-pixelation) based on lighting
 void Viewer::SETFAD() {
   dodBYTE a, b;
@@ -1528,13 +1511,18 @@ void Viewer::SETFAD() {
 }
 
 // Used by 3D-Viewer, draws a vector list
-void Viewer::DRAWIT(int *vl) {
+void Viewer::DRAWIT(const dodBYTE *vl) {
   SETFAD();
+  if (recordView) {
+    ViewCmd cmd = {vl, VXSCALf, VYSCALf, scaleIdx, VCTFAD};
+    viewCmds.push_back(cmd);
+    return;
+  }
   drawVectorList(vl);
 }
 
 // Used by 3D-Viewer, checks for around-the-corner creature
-void Viewer::PDRAW(int *vl, dodBYTE dir, dodBYTE pdir) {
+void Viewer::PDRAW(const dodBYTE *vl, dodBYTE dir, dodBYTE pdir) {
   RowCol side;
   dodBYTE DIR;
   int creNum;
@@ -1550,7 +1538,7 @@ void Viewer::PDRAW(int *vl, dodBYTE dir, dodBYTE pdir) {
 }
 
 // Prepares for drawing creature with either magical or physical lighting
-void Viewer::CMRDRW(int *vl, int creNum) {
+void Viewer::CMRDRW(const dodBYTE *vl, int creNum) {
   if (creature.CCBLND[creNum].P_CCMGO != 0)
     --MAGFLG;
   DRAWIT(vl);
@@ -1565,6 +1553,7 @@ void Viewer::SETSCL() {
       idx = 0;
     }
   }
+  scaleIdx = idx + RANGE;
   VXSCAL = Scale[idx + RANGE];
   VYSCAL = Scale[idx + RANGE];
   VXSCALf = Scalef[idx + RANGE];
@@ -1585,14 +1574,12 @@ void Viewer::EXAMIN() {
   }
 
   // check for objects on floor
+  RowCol here(player.PROW, player.PCOL);
   int idx;
-  object.OFINDF = 0;
-  do {
-    idx = object.OFIND(RowCol(player.PROW, player.PCOL));
-    if (idx != -1) {
-      PRTOBJ(idx, false);
-    }
-  } while (idx != -1);
+  for (idx = object.NextInCell(here, -1); idx != -1;
+       idx = object.NextInCell(here, idx)) {
+    PRTOBJ(idx, false);
+  }
 
   if (NEWLIN != 0) {
     PCRLF();
@@ -1643,22 +1630,20 @@ const char *Viewer::getInventory() {
 const char *Viewer::getFloor() {
   currentFloor.clear();
 
+  RowCol here(player.PROW, player.PCOL);
   int ctr;
-  object.OFINDF = 0;
-  do {
-    ctr = object.OFIND(RowCol(player.PROW, player.PCOL));
-    if (ctr != -1) {
-      object.OBJNAM(ctr);
-      int x = 0;
-
-      while (*(parser.TOKEN + x) != 0xFF) {
-        char curChar = dodToChar(*(parser.TOKEN + x));
-        currentFloor.append(1, curChar);
-        ++x;
-      }
-      currentFloor.append(1, '|');
+  for (ctr = object.NextInCell(here, -1); ctr != -1;
+       ctr = object.NextInCell(here, ctr)) {
+    object.OBJNAM(ctr);
+    int x = 0;
+
+    while (*(parser.TOKEN + x) != 0xFF) {
+      char curChar = dodToChar(*(parser.TOKEN + x));
+      currentFloor.append(1, curChar);
+      ++x;
     }
-  } while (ctr != -1);
+    currentFloor.append(1, '|');
+  }
 
   return currentFloor.c_str();
 }
@@ -1688,30 +1673,23 @@ void Viewer::PRTOBJ(int X, bool highlite) {
   }
 }
 
-// Draws the map; showSeerMap bool determines VISION or SEER mode
-void Viewer::MAPPER() {
-  int mazIdx, objIdx, creIdx, vftIdx;
+// Map colors: black walls, white door marks and seer markers
+static const GLfloat mapBlack[3] = {0.0f, 0.0f, 0.0f};
+static const GLfloat mapWhite[3] = {1.0f, 1.0f, 1.0f};
+
+// Queues the map's walls and the doors, if they are marked
+void Viewer::MAPWAL() {
+  int mazIdx;
   float DoorOffset;
-  RowCol rc;
-  dodBYTE a;
-  bool vftOnce;
 
   dungeon.DROW.row = 31;
   dungeon.DROW.col = 31;
-  glColor3f(0.0, 0.0, 0.0);
   do {
     mazIdx = dungeon.RC2IDX(dungeon.DROW.row, dungeon.DROW.col);
     if (dungeon.MAZLND[mazIdx] != 0xFF) {
-      glBegin(GL_QUADS);
-      glVertex2f(crd.newX(dungeon.DROW.col * 8),
-                 crd.newY(dungeon.DROW.row * 6));
-      glVertex2f(crd.newX(dungeon.DROW.col * 8),
-                 crd.newY((dungeon.DROW.row + 1) * 6));
-      glVertex2f(crd.newX((dungeon.DROW.col + 1) * 8),
-                 crd.newY((dungeon.DROW.row + 1) * 6));
-      glVertex2f(crd.newX((dungeon.DROW.col + 1) * 8),
-                 crd.newY(dungeon.DROW.row * 6));
-      glEnd();
+      addBatchedQuad(dungeon.DROW.col * 8, dungeon.DROW.row * 6,
+                     (dungeon.DROW.col + 1) * 8, (dungeon.DROW.row + 1) * 6,
+                     mapBlack);
       if (game.MarkDoorsOnScrollMaps) { // Do we need to mark the doors on the
                                         // scroll maps?
         if ((dungeon.MAZLND[mazIdx] & 0x0c) == (0x01 << 2) ||
@@ -1721,90 +1699,62 @@ void Viewer::MAPPER() {
                         0xff); // Move door line over one into next room if we
                                // don't have wall on either side.
           DoorOffset = DoorOffset / 4;
-          glColor3f(1.0, 1.0, 1.0);
           if ((dungeon.MAZLND[mazIdx] & 0x0c) ==
               (0x01 << 2)) { // Is this a regular door?  Yes:
-            glBegin(GL_LINES);
-            glVertex2f(crd.newX((dungeon.DROW.col + 1) * 8 + DoorOffset),
-                       crd.newY(dungeon.DROW.row * 6));
-            glVertex2f(crd.newX((dungeon.DROW.col + 1) * 8 + DoorOffset),
-                       crd.newY(dungeon.DROW.row * 6 + 2.5));
-            glEnd();
-            glBegin(GL_LINES);
-            glVertex2f(crd.newX((dungeon.DROW.col + 1) * 8 + DoorOffset),
-                       crd.newY(dungeon.DROW.row * 6 + 4));
-            glVertex2f(crd.newX((dungeon.DROW.col + 1) * 8 + DoorOffset),
-                       crd.newY((dungeon.DROW.row + 1) * 6));
-            glEnd();
-            glBegin(GL_LINES);
-            glVertex2f(crd.newX((dungeon.DROW.col + 1) * 8 + 0.75 + DoorOffset),
-                       crd.newY(dungeon.DROW.row * 6 + 2.5));
-            glVertex2f(crd.newX((dungeon.DROW.col + 1) * 8 - 1 + DoorOffset),
-                       crd.newY(dungeon.DROW.row * 6 + 2.5));
-            glEnd();
-            glBegin(GL_LINES);
-            glVertex2f(crd.newX((dungeon.DROW.col + 1) * 8 - 0.75 + DoorOffset),
-                       crd.newY(dungeon.DROW.row * 6 + 2.5));
-            glVertex2f(crd.newX((dungeon.DROW.col + 1) * 8 - 0.75 + DoorOffset),
-                       crd.newY(dungeon.DROW.row * 6 + 4));
-            glEnd();
-            glBegin(GL_LINES);
-            glVertex2f(crd.newX((dungeon.DROW.col + 1) * 8 + 0.75 + DoorOffset),
-                       crd.newY(dungeon.DROW.row * 6 + 4));
-            glVertex2f(crd.newX((dungeon.DROW.col + 1) * 8 + 0.75 + DoorOffset),
-                       crd.newY(dungeon.DROW.row * 6 + 2.5));
-            glEnd();
-            glBegin(GL_LINES);
-            glVertex2f(crd.newX((dungeon.DROW.col + 1) * 8 - 1 + DoorOffset),
-                       crd.newY(dungeon.DROW.row * 6 + 4));
-            glVertex2f(crd.newX((dungeon.DROW.col + 1) * 8 + 0.75 + DoorOffset),
-                       crd.newY(dungeon.DROW.row * 6 + 4));
-            glEnd();
+            addBatchedLine((dungeon.DROW.col + 1) * 8 + DoorOffset,
+                           dungeon.DROW.row * 6,
+                           (dungeon.DROW.col + 1) * 8 + DoorOffset,
+                           dungeon.DROW.row * 6 + 2.5, mapWhite);
+            addBatchedLine((dungeon.DROW.col + 1) * 8 + DoorOffset,
+                           dungeon.DROW.row * 6 + 4,
+                           (dungeon.DROW.col + 1) * 8 + DoorOffset,
+                           (dungeon.DROW.row + 1) * 6, mapWhite);
+            addBatchedLine((dungeon.DROW.col + 1) * 8 + 0.75 + DoorOffset,
+                           dungeon.DROW.row * 6 + 2.5,
+                           (dungeon.DROW.col + 1) * 8 - 1 + DoorOffset,
+                           dungeon.DROW.row * 6 + 2.5, mapWhite);
+            addBatchedLine((dungeon.DROW.col + 1) * 8 - 0.75 + DoorOffset,
+                           dungeon.DROW.row * 6 + 2.5,
+                           (dungeon.DROW.col + 1) * 8 - 0.75 + DoorOffset,
+                           dungeon.DROW.row * 6 + 4, mapWhite);
+            addBatchedLine((dungeon.DROW.col + 1) * 8 + 0.75 + DoorOffset,
+                           dungeon.DROW.row * 6 + 4,
+                           (dungeon.DROW.col + 1) * 8 + 0.75 + DoorOffset,
+                           dungeon.DROW.row * 6 + 2.5, mapWhite);
+            addBatchedLine((dungeon.DROW.col + 1) * 8 - 1 + DoorOffset,
+                           dungeon.DROW.row * 6 + 4,
+                           (dungeon.DROW.col + 1) * 8 + 0.75 + DoorOffset,
+                           dungeon.DROW.row * 6 + 4, mapWhite);
           } else { // Is this a regular door?  No:
-            glBegin(GL_LINES);
-            glVertex2f(crd.newX((dungeon.DROW.col + 1) * 8 + DoorOffset),
-                       crd.newY(dungeon.DROW.row * 6));
-            glVertex2f(crd.newX((dungeon.DROW.col + 1) * 8 + DoorOffset),
-                       crd.newY(dungeon.DROW.row * 6 + 1.75));
-            glEnd();
-            glBegin(GL_LINES);
-            glVertex2f(crd.newX((dungeon.DROW.col + 1) * 8 + DoorOffset),
-                       crd.newY(dungeon.DROW.row * 6 + 4.5));
-            glVertex2f(crd.newX((dungeon.DROW.col + 1) * 8 + DoorOffset),
-                       crd.newY((dungeon.DROW.row + 1) * 6));
-            glEnd();
-            glBegin(GL_LINES);
-            glVertex2f(crd.newX((dungeon.DROW.col + 1) * 8 + 0.75 + DoorOffset),
-                       crd.newY(dungeon.DROW.row * 6 + 2.25));
-            glVertex2f(crd.newX((dungeon.DROW.col + 1) * 8 - 0.75 + DoorOffset),
-                       crd.newY(dungeon.DROW.row * 6 + 2.25));
-            glEnd();
-            glBegin(GL_LINES);
-            glVertex2f(crd.newX((dungeon.DROW.col + 1) * 8 - 0.75 + DoorOffset),
-                       crd.newY(dungeon.DROW.row * 6 + 2.25));
-            glVertex2f(crd.newX((dungeon.DROW.col + 1) * 8 - 0.75 + DoorOffset),
-                       crd.newY(dungeon.DROW.row * 6 + 3));
-            glEnd();
-            glBegin(GL_LINES);
-            glVertex2f(crd.newX((dungeon.DROW.col + 1) * 8 + 0.5 + DoorOffset),
-                       crd.newY(dungeon.DROW.row * 6 + 3.25));
-            glVertex2f(crd.newX((dungeon.DROW.col + 1) * 8 - 0.75 + DoorOffset),
-                       crd.newY(dungeon.DROW.row * 6 + 3.25));
-            glEnd();
-            glBegin(GL_LINES);
-            glVertex2f(crd.newX((dungeon.DROW.col + 1) * 8 + 0.75 + DoorOffset),
-                       crd.newY(dungeon.DROW.row * 6 + 3.25));
-            glVertex2f(crd.newX((dungeon.DROW.col + 1) * 8 + 0.75 + DoorOffset),
-                       crd.newY(dungeon.DROW.row * 6 + 4));
-            glEnd();
-            glBegin(GL_LINES);
-            glVertex2f(crd.newX((dungeon.DROW.col + 1) * 8 - 1 + DoorOffset),
-                       crd.newY(dungeon.DROW.row * 6 + 4.25));
-            glVertex2f(crd.newX((dungeon.DROW.col + 1) * 8 + 0.5 + DoorOffset),
-                       crd.newY(dungeon.DROW.row * 6 + 4.25));
-            glEnd();
+            addBatchedLine((dungeon.DROW.col + 1) * 8 + DoorOffset,
+                           dungeon.DROW.row * 6,
+                           (dungeon.DROW.col + 1) * 8 + DoorOffset,
+                           dungeon.DROW.row * 6 + 1.75, mapWhite);
+            addBatchedLine((dungeon.DROW.col + 1) * 8 + DoorOffset,
+                           dungeon.DROW.row * 6 + 4.5,
+                           (dungeon.DROW.col + 1) * 8 + DoorOffset,
+                           (dungeon.DROW.row + 1) * 6, mapWhite);
+            addBatchedLine((dungeon.DROW.col + 1) * 8 + 0.75 + DoorOffset,
+                           dungeon.DROW.row * 6 + 2.25,
+                           (dungeon.DROW.col + 1) * 8 - 0.75 + DoorOffset,
+                           dungeon.DROW.row * 6 + 2.25, mapWhite);
+            addBatchedLine((dungeon.DROW.col + 1) * 8 - 0.75 + DoorOffset,
+                           dungeon.DROW.row * 6 + 2.25,
+                           (dungeon.DROW.col + 1) * 8 - 0.75 + DoorOffset,
+                           dungeon.DROW.row * 6 + 3, mapWhite);
+            addBatchedLine((dungeon.DROW.col + 1) * 8 + 0.5 + DoorOffset,
+                           dungeon.DROW.row * 6 + 3.25,
+                           (dungeon.DROW.col + 1) * 8 - 0.75 + DoorOffset,
+                           dungeon.DROW.row * 6 + 3.25, mapWhite);
+            addBatchedLine((dungeon.DROW.col + 1) * 8 + 0.75 + DoorOffset,
+                           dungeon.DROW.row * 6 + 3.25,
+                           (dungeon.DROW.col + 1) * 8 + 0.75 + DoorOffset,
+                           dungeon.DROW.row * 6 + 4, mapWhite);
+            addBatchedLine((dungeon.DROW.col + 1) * 8 - 1 + DoorOffset,
+                           dungeon.DROW.row * 6 + 4.25,
+                           (dungeon.DROW.col + 1) * 8 + 0.5 + DoorOffset,
+                           dungeon.DROW.row * 6 + 4.25, mapWhite);
           } // Is this a regular door?
-          glColor3f(0.0, 0.0, 0.0);
         } // Do we have a east door or secret door?
         if ((dungeon.MAZLND[mazIdx] & 0x30) == (0x01 << 4) ||
             (dungeon.MAZLND[mazIdx] & 0x30) ==
@@ -1813,100 +1763,70 @@ void Viewer::MAPPER() {
                         0xff); // Move door line over one into next room if we
                                // don't have wall on either side.
           DoorOffset = DoorOffset / 4;
-          glColor3f(1.0, 1.0, 1.0);
           if ((dungeon.MAZLND[mazIdx] & 0x30) ==
               (0x01 << 4)) { // Is this a regular door?  Yes:
-            glBegin(GL_LINES);
-            glVertex2f(crd.newX(dungeon.DROW.col * 8),
-                       crd.newY((dungeon.DROW.row + 1) * 6 + DoorOffset));
-            glVertex2f(crd.newX(dungeon.DROW.col * 8 + 3.25),
-                       crd.newY((dungeon.DROW.row + 1) * 6 + DoorOffset));
-            glEnd();
-            glBegin(GL_LINES);
-            glVertex2f(crd.newX(dungeon.DROW.col * 8 + 4.75),
-                       crd.newY((dungeon.DROW.row + 1) * 6 + DoorOffset));
-            glVertex2f(crd.newX((dungeon.DROW.col + 1) * 8),
-                       crd.newY((dungeon.DROW.row + 1) * 6 + DoorOffset));
-            glEnd();
-            glBegin(GL_LINES);
-            glVertex2f(
-                crd.newX(dungeon.DROW.col * 8 + 3),
-                crd.newY((dungeon.DROW.row + 1) * 6 - 0.75 + DoorOffset));
-            glVertex2f(
-                crd.newX(dungeon.DROW.col * 8 + 4.75),
-                crd.newY((dungeon.DROW.row + 1) * 6 - 0.75 + DoorOffset));
-            glEnd();
-            glBegin(GL_LINES);
-            glVertex2f(
-                crd.newX(dungeon.DROW.col * 8 + 4.75),
-                crd.newY((dungeon.DROW.row + 1) * 6 - 0.75 + DoorOffset));
-            glVertex2f(
-                crd.newX(dungeon.DROW.col * 8 + 4.75),
-                crd.newY((dungeon.DROW.row + 1) * 6 + 0.75 + DoorOffset));
-            glEnd();
-            glBegin(GL_LINES);
-            glVertex2f(
-                crd.newX(dungeon.DROW.col * 8 + 3.25),
-                crd.newY((dungeon.DROW.row + 1) * 6 + 0.75 + DoorOffset));
-            glVertex2f(
-                crd.newX(dungeon.DROW.col * 8 + 3.25),
-                crd.newY((dungeon.DROW.row + 1) * 6 - 0.75 + DoorOffset));
-            glEnd();
-            glBegin(GL_LINES);
-            glVertex2f(
-                crd.newX(dungeon.DROW.col * 8 + 3.25),
-                crd.newY((dungeon.DROW.row + 1) * 6 + 0.75 + DoorOffset));
-            glVertex2f(
-                crd.newX(dungeon.DROW.col * 8 + 4.75),
-                crd.newY((dungeon.DROW.row + 1) * 6 + 0.75 + DoorOffset));
-            glEnd();
+            addBatchedLine(dungeon.DROW.col * 8,
+                           (dungeon.DROW.row + 1) * 6 + DoorOffset,
+                           dungeon.DROW.col * 8 + 3.25,
+                           (dungeon.DROW.row + 1) * 6 + DoorOffset, mapWhite);
+            addBatchedLine(dungeon.DROW.col * 8 + 4.75,
+                           (dungeon.DROW.row + 1) * 6 + DoorOffset,
+                           (dungeon.DROW.col + 1) * 8,
+                           (dungeon.DROW.row + 1) * 6 + DoorOffset, mapWhite);
+            addBatchedLine(dungeon.DROW.col * 8 + 3,
+                           (dungeon.DROW.row + 1) * 6 - 0.75 + DoorOffset,
+                           dungeon.DROW.col * 8 + 4.75,
+                           (dungeon.DROW.row + 1) * 6 - 0.75 + DoorOffset,
+                           mapWhite);
+            addBatchedLine(dungeon.DROW.col * 8 + 4.75,
+                           (dungeon.DROW.row + 1) * 6 - 0.75 + DoorOffset,
+                           dungeon.DROW.col * 8 + 4.75,
+                           (dungeon.DROW.row + 1) * 6 + 0.75 + DoorOffset,
+                           mapWhite);
+            addBatchedLine(dungeon.DROW.col * 8 + 3.25,
+                           (dungeon.DROW.row + 1) * 6 + 0.75 + DoorOffset,
+                           dungeon.DROW.col * 8 + 3.25,
+                           (dungeon.DROW.row + 1) * 6 - 0.75 + DoorOffset,
+                           mapWhite);
+            addBatchedLine(dungeon.DROW.col * 8 + 3.25,
+                           (dungeon.DROW.row + 1) * 6 + 0.75 + DoorOffset,
+                           dungeon.DROW.col * 8 + 4.75,
+                           (dungeon.DROW.row + 1) * 6 + 0.75 + DoorOffset,
+                           mapWhite);
           } else { // Is this a regular door?  No:
-            glBegin(GL_LINES);
-            glVertex2f(crd.newX(dungeon.DROW.col * 8),
-                       crd.newY((dungeon.DROW.row + 1) * 6 + DoorOffset));
-            glVertex2f(crd.newX(dungeon.DROW.col * 8 + 2.75),
-                       crd.newY((dungeon.DROW.row + 1) * 6 + DoorOffset));
-            glEnd();
-            glBegin(GL_LINES);
-            glVertex2f(crd.newX(dungeon.DROW.col * 8 + 5),
-                       crd.newY((dungeon.DROW.row + 1) * 6 + DoorOffset));
-            glVertex2f(crd.newX((dungeon.DROW.col + 1) * 8),
-                       crd.newY((dungeon.DROW.row + 1) * 6 + DoorOffset));
-            glEnd();
-            glBegin(GL_LINES);
-            glVertex2f(crd.newX(dungeon.DROW.col * 8 + 3.25),
-                       crd.newY((dungeon.DROW.row + 1) * 6 - 1 + DoorOffset));
-            glVertex2f(crd.newX(dungeon.DROW.col * 8 + 4.75),
-                       crd.newY((dungeon.DROW.row + 1) * 6 - 1 + DoorOffset));
-            glEnd();
-            glBegin(GL_LINES);
-            glVertex2f(crd.newX(dungeon.DROW.col * 8 + 3.25),
-                       crd.newY((dungeon.DROW.row + 1) * 6 - 1 + DoorOffset));
-            glVertex2f(
-                crd.newX(dungeon.DROW.col * 8 + 3.25),
-                crd.newY((dungeon.DROW.row + 1) * 6 - 0.25 + DoorOffset));
-            glEnd();
-            glBegin(GL_LINES);
-            glVertex2f(crd.newX(dungeon.DROW.col * 8 + 3.25),
-                       crd.newY((dungeon.DROW.row + 1) * 6 + DoorOffset));
-            glVertex2f(crd.newX(dungeon.DROW.col * 8 + 4.5),
-                       crd.newY((dungeon.DROW.row + 1) * 6 + DoorOffset));
-            glEnd();
-            glBegin(GL_LINES);
-            glVertex2f(crd.newX(dungeon.DROW.col * 8 + 4.75),
-                       crd.newY((dungeon.DROW.row + 1) * 6 + DoorOffset));
-            glVertex2f(
-                crd.newX(dungeon.DROW.col * 8 + 4.75),
-                crd.newY((dungeon.DROW.row + 1) * 6 + 0.75 + DoorOffset));
-            glEnd();
-            glBegin(GL_LINES);
-            glVertex2f(crd.newX(dungeon.DROW.col * 8 + 3),
-                       crd.newY((dungeon.DROW.row + 1) * 6 + 1 + DoorOffset));
-            glVertex2f(crd.newX(dungeon.DROW.col * 8 + 4.5),
-                       crd.newY((dungeon.DROW.row + 1) * 6 + 1 + DoorOffset));
-            glEnd();
+            addBatchedLine(dungeon.DROW.col * 8,
+                           (dungeon.DROW.row + 1) * 6 + DoorOffset,
+                           dungeon.DROW.col * 8 + 2.75,
+                           (dungeon.DROW.row + 1) * 6 + DoorOffset, mapWhite);
+            addBatchedLine(dungeon.DROW.col * 8 + 5,
+                           (dungeon.DROW.row + 1) * 6 + DoorOffset,
+                           (dungeon.DROW.col + 1) * 8,
+                           (dungeon.DROW.row + 1) * 6 + DoorOffset, mapWhite);
+            addBatchedLine(dungeon.DROW.col * 8 + 3.25,
+                           (dungeon.DROW.row + 1) * 6 - 1 + DoorOffset,
+                           dungeon.DROW.col * 8 + 4.75,
+                           (dungeon.DROW.row + 1) * 6 - 1 + DoorOffset,
+                           mapWhite);
+            addBatchedLine(dungeon.DROW.col * 8 + 3.25,
+                           (dungeon.DROW.row + 1) * 6 - 1 + DoorOffset,
+                           dungeon.DROW.col * 8 + 3.25,
+                           (dungeon.DROW.row + 1) * 6 - 0.25 + DoorOffset,
+                           mapWhite);
+            addBatchedLine(dungeon.DROW.col * 8 + 3.25,
+                           (dungeon.DROW.row + 1) * 6 + DoorOffset,
+                           dungeon.DROW.col * 8 + 4.5,
+                           (dungeon.DROW.row + 1) * 6 + DoorOffset, mapWhite);
+            addBatchedLine(dungeon.DROW.col * 8 + 4.75,
+                           (dungeon.DROW.row + 1) * 6 + DoorOffset,
+                           dungeon.DROW.col * 8 + 4.75,
+                           (dungeon.DROW.row + 1) * 6 + 0.75 + DoorOffset,
+                           mapWhite);
+            addBatchedLine(dungeon.DROW.col * 8 + 3,
+                           (dungeon.DROW.row + 1) * 6 + 1 + DoorOffset,
+                           dungeon.DROW.col * 8 + 4.5,
+                           (dungeon.DROW.row + 1) * 6 + 1 + DoorOffset,
+                           mapWhite);
           }
-          glColor3f(0.0, 0.0, 0.0);
         } // Do we have a south door or secret door?
       }   // Do we need to mark the doors on the scroll maps?
     }
@@ -1916,27 +1836,39 @@ void Viewer::MAPPER() {
       dungeon.DROW.col = 31;
     }
   } while (dungeon.DROW.row != 0xFF);
+}
+
+// Queues the map; showSeerMap bool determines VISION or SEER mode
+void Viewer::MAPPER() {
+  int objIdx, creIdx, vftIdx;
+  RowCol rc;
+  dodBYTE a;
+  bool vftOnce;
+
+  // The walls and doors only change with the maze, so they are
+  // drawn from the map cache until it is for another maze
+  if (mapMarkDoors != game.MarkDoorsOnScrollMaps ||
+      memcmp(mapMaze, dungeon.MAZLND, sizeof(mapMaze)) != 0 ||
+      !mapCache.draw()) {
+    MAPWAL();
+    flushLines(); // the cache copies the framebuffer
+    mapCache.capture();
+    memcpy(mapMaze, dungeon.MAZLND, sizeof(mapMaze));
+    mapMarkDoors = game.MarkDoorsOnScrollMaps;
+  }
 
-  glColor3f(1.0, 1.0, 1.0);
   if (showSeerMap == true) {
     // Mark Objects
-    object.OFINDF = 0;
-    do {
-      objIdx = object.FNDOBJ();
-      if (objIdx == -1)
-        break;
+    for (objIdx = object.NextOnLevel(-1); objIdx != -1;
+         objIdx = object.NextOnLevel(objIdx)) {
       if (object.OCBLND[objIdx].P_OCOWN != 0)
         continue;
       rc.row = object.OCBLND[objIdx].P_OCROW;
       rc.col = object.OCBLND[objIdx].P_OCCOL;
-      glBegin(GL_QUADS);
-      glVertex2f(crd.newX((rc.col * 8) + 4), crd.newY((rc.row * 6) + 2));
-      glVertex2f(crd.newX((rc.col * 8) + 4), crd.newY((rc.row * 6) + 4));
-      glVertex2f(crd.newX((rc.col * 8) + 5), crd.newY((rc.row * 6) + 4));
-      glVertex2f(crd.newX((rc.col * 8) + 5), crd.newY((rc.row * 6) + 2));
-      glEnd();
+      addBatchedQuad((rc.col * 8) + 4, (rc.row * 6) + 2, (rc.col * 8) + 5,
+                     (rc.row * 6) + 4, mapWhite);
       // Need to yield?
-    } while (true);
+    }
 
     // Mark Creatures
     creIdx = -1;
@@ -1948,22 +1880,12 @@ void Viewer::MAPPER() {
         continue;
       rc.row = creature.CCBLND[creIdx].P_CCROW;
       rc.col = creature.CCBLND[creIdx].P_CCCOL;
-      glBegin(GL_QUADS);
-      glVertex2f(crd.newX((rc.col * 8) + 1), crd.newY((rc.row * 6) + 2));
-      glVertex2f(crd.newX((rc.col * 8) + 1), crd.newY((rc.row * 6) + 4));
-      glVertex2f(crd.newX((rc.col * 8) + 2), crd.newY((rc.row * 6) + 4));
-      glVertex2f(crd.newX((rc.col * 8) + 2), crd.newY((rc.row * 6) + 2));
-
-      glVertex2f(crd.newX((rc.col * 8) + 5), crd.newY((rc.row * 6) + 2));
-      glVertex2f(crd.newX((rc.col * 8) + 5), crd.newY((rc.row * 6) + 4));
-      glVertex2f(crd.newX((rc.col * 8) + 6), crd.newY((rc.row * 6) + 4));
-      glVertex2f(crd.newX((rc.col * 8) + 6), crd.newY((rc.row * 6) + 2));
-
-      glVertex2f(crd.newX((rc.col * 8) + 3), crd.newY((rc.row * 6) + 1));
-      glVertex2f(crd.newX((rc.col * 8) + 3), crd.newY((rc.row * 6) + 5));
-      glVertex2f(crd.newX((rc.col * 8) + 4), crd.newY((rc.row * 6) + 5));
-      glVertex2f(crd.newX((rc.col * 8) + 4), crd.newY((rc.row * 6) + 1));
-      glEnd();
+      addBatchedQuad((rc.col * 8) + 1, (rc.row * 6) + 2, (rc.col * 8) + 2,
+                     (rc.row * 6) + 4, mapWhite);
+      addBatchedQuad((rc.col * 8) + 5, (rc.row * 6) + 2, (rc.col * 8) + 6,
+                     (rc.row * 6) + 4, mapWhite);
+      addBatchedQuad((rc.col * 8) + 3, (rc.row * 6) + 1, (rc.col * 8) + 4,
+                     (rc.row * 6) + 5, mapWhite);
       // Need to yield?
     } while (true);
   }
@@ -1971,32 +1893,16 @@ void Viewer::MAPPER() {
   // Mark Player
   rc.row = player.PROW;
   rc.col = player.PCOL;
-  glBegin(GL_QUADS);
-  glVertex2f(crd.newX((rc.col * 8) + 2), crd.newY((rc.row * 6) + 1));
-  glVertex2f(crd.newX((rc.col * 8) + 2), crd.newY((rc.row * 6) + 2));
-  glVertex2f(crd.newX((rc.col * 8) + 3), crd.newY((rc.row * 6) + 2));
-  glVertex2f(crd.newX((rc.col * 8) + 3), crd.newY((rc.row * 6) + 1));
-
-  glVertex2f(crd.newX((rc.col * 8) + 5), crd.newY((rc.row * 6) + 1));
-  glVertex2f(crd.newX((rc.col * 8) + 5), crd.newY((rc.row * 6) + 2));
-  glVertex2f(crd.newX((rc.col * 8) + 6), crd.newY((rc.row * 6) + 2));
-  glVertex2f(crd.newX((rc.col * 8) + 6), crd.newY((rc.row * 6) + 1));
-
-  glVertex2f(crd.newX((rc.col * 8) + 3), crd.newY((rc.row * 6) + 2));
-  glVertex2f(crd.newX((rc.col * 8) + 3), crd.newY((rc.row * 6) + 4));
-  glVertex2f(crd.newX((rc.col * 8) + 5), crd.newY((rc.row * 6) + 4));
-  glVertex2f(crd.newX((rc.col * 8) + 5), crd.newY((rc.row * 6) + 2));
-
-  glVertex2f(crd.newX((rc.col * 8) + 2), crd.newY((rc.row * 6) + 4));
-  glVertex2f(crd.newX((rc.col * 8) + 2), crd.newY((rc.row * 6) + 5));
-  glVertex2f(crd.newX((rc.col * 8) + 3), crd.newY((rc.row * 6) + 5));
-  glVertex2f(crd.newX((rc.col * 8) + 3), crd.newY((rc.row * 6) + 4));
-
-  glVertex2f(crd.newX((rc.col * 8) + 5), crd.newY((rc.row * 6) + 4));
-  glVertex2f(crd.newX((rc.col * 8) + 5), crd.newY((rc.row * 6) + 5));
-  glVertex2f(crd.newX((rc.col * 8) + 6), crd.newY((rc.row * 6) + 5));
-  glVertex2f(crd.newX((rc.col * 8) + 6), crd.newY((rc.row * 6) + 4));
-  glEnd();
+  addBatchedQuad((rc.col * 8) + 2, (rc.row * 6) + 1, (rc.col * 8) + 3,
+                 (rc.row * 6) + 2, mapWhite);
+  addBatchedQuad((rc.col * 8) + 5, (rc.row * 6) + 1, (rc.col * 8) + 6,
+                 (rc.row * 6) + 2, mapWhite);
+  addBatchedQuad((rc.col * 8) + 3, (rc.row * 6) + 2, (rc.col * 8) + 5,
+                 (rc.row * 6) + 4, mapWhite);
+  addBatchedQuad((rc.col * 8) + 2, (rc.row * 6) + 4, (rc.col * 8) + 3,
+                 (rc.row * 6) + 5, mapWhite);
+  addBatchedQuad((rc.col * 8) + 5, (rc.row * 6) + 4, (rc.col * 8) + 6,
+                 (rc.row * 6) + 5, mapWhite);
 
   // Mark Vertical Features
   vftIdx = dungeon.VFTPTR;
@@ -2014,39 +1920,37 @@ void Viewer::MAPPER() {
     rc.row = dungeon.VFTTAB[vftIdx++];
     rc.col = dungeon.VFTTAB[vftIdx++];
 
-    glBegin(GL_QUADS);
-    glVertex2f(crd.newX((rc.col * 8) + 2), crd.newY((rc.row * 6) + 1));
-    glVertex2f(crd.newX((rc.col * 8) + 2), crd.newY((rc.row * 6) + 5));
-    glVertex2f(crd.newX((rc.col * 8) + 3), crd.newY((rc.row * 6) + 5));
-    glVertex2f(crd.newX((rc.col * 8) + 3), crd.newY((rc.row * 6) + 1));
-
-    glVertex2f(crd.newX((rc.col * 8) + 5), crd.newY((rc.row * 6) + 1));
-    glVertex2f(crd.newX((rc.col * 8) + 5), crd.newY((rc.row * 6) + 5));
-    glVertex2f(crd.newX((rc.col * 8) + 6), crd.newY((rc.row * 6) + 5));
-    glVertex2f(crd.newX((rc.col * 8) + 6), crd.newY((rc.row * 6) + 1));
-
-    glVertex2f(crd.newX((rc.col * 8) + 3), crd.newY((rc.row * 6) + 1));
-    glVertex2f(crd.newX((rc.col * 8) + 3), crd.newY((rc.row * 6) + 2));
-    glVertex2f(crd.newX((rc.col * 8) + 5), crd.newY((rc.row * 6) + 2));
-    glVertex2f(crd.newX((rc.col * 8) + 5), crd.newY((rc.row * 6) + 1));
-
-    glVertex2f(crd.newX((rc.col * 8) + 3), crd.newY((rc.row * 6) + 4));
-    glVertex2f(crd.newX((rc.col * 8) + 3), crd.newY((rc.row * 6) + 5));
-    glVertex2f(crd.newX((rc.col * 8) + 5), crd.newY((rc.row * 6) + 5));
-    glVertex2f(crd.newX((rc.col * 8) + 5), crd.newY((rc.row * 6) + 4));
-    glEnd();
+    addBatchedQuad((rc.col * 8) + 2, (rc.row * 6) + 1, (rc.col * 8) + 3,
+                   (rc.row * 6) + 5, mapWhite);
+    addBatchedQuad((rc.col * 8) + 5, (rc.row * 6) + 1, (rc.col * 8) + 6,
+                   (rc.row * 6) + 5, mapWhite);
+    addBatchedQuad((rc.col * 8) + 3, (rc.row * 6) + 1, (rc.col * 8) + 5,
+                   (rc.row * 6) + 2, mapWhite);
+    addBatchedQuad((rc.col * 8) + 3, (rc.row * 6) + 4, (rc.col * 8) + 5,
+                   (rc.row * 6) + 5, mapWhite);
     // Need to yield?
   } while (true);
 }
 
-// Draws non-font vector lists
-void Viewer::drawVectorList(int VLA[]) {
-  int numLists = VLA[0];
-  int curList = 0;
-  int numVertices;
-  int curVertex;
-  int ctr = 1;
+// Uploads every line vector list to the vector store.  These
+// never change once the constructor has pointed at them.
+void Viewer::storeVectorLists() {
+  const dodBYTE *lists[] = {
+      SP_VLA,   WR_VLA,   SC_VLA,   BL_VLA,   GL_VLA,   VI_VLA,   S1_VLA,
+      S2_VLA,   K1_VLA,   K2_VLA,   W0_VLA,   W1_VLA,   W2_VLA,   LAD_VLA,
+      HUP_VLA,  HDN_VLA,  CEI_VLA,  LPK_VLA,  RPK_VLA,  FSD_VLA,  LSD_VLA,
+      RSD_VLA,  RWAL_VLA, LWAL_VLA, FWAL_VLA, RPAS_VLA, LPAS_VLA, FPAS_VLA,
+      RDOR_VLA, LDOR_VLA, FDOR_VLA, SHIE_VLA, SWOR_VLA, TORC_VLA, RING_VLA,
+      SCRO_VLA, FLAS_VLA, LINES};
+
+  for (size_t ctr = 0; ctr < sizeof(lists) / sizeof(lists[0]); ++ctr) {
+    vecStore.add(lists[ctr]);
+  }
+  vecStore.finish();
+}
 
+// Draws non-font vector lists
+void Viewer::drawVectorList(const dodBYTE VLA[]) {
   if (VCTFAD == 0xFF) {
     return;
   }
@@ -2054,42 +1958,68 @@ void Viewer::drawVectorList(int VLA[]) {
   // Use batched line drawing when in vector mode for better performance
   bool useVectorMode = (g_options & OPT_VECTOR) != 0;
   if (useVectorMode) {
-    beginLineBatch();
+    // Resident lists are queued for the frame, scaled on the GPU
+    if (vecStore.queue(VLA, VXSCALf / 127.0f, VYSCALf / 127.0f,
+                       (float)VCNTRX, (float)VCNTRY, fadeColors[VCTFAD])) {
+      return;
+    }
+  }
+
+  const std::vector<float> &ends = scaledVectorList(VLA);
+  for (size_t ctr = 0; ctr < ends.size(); ctr += 4) {
+    float x0 = ends[ctr], y0 = ends[ctr + 1];
+    float x1 = ends[ctr + 2], y1 = ends[ctr + 3];
+
+    if (useVectorMode) {
+      // Queued for the frame's single line draw
+      addBatchedLine(x0, y0, x1, y1);
+    } else if (g_options & OPT_HIRES) {
+      // HIRES mode still uses immediate drawing
+      drawVector(x0, y0, x1, y1);
+    } else {
+      // Standard mode - truncate to integer coordinates
+      drawVector((float)(int)x0, (float)(int)y0, (float)(int)x1,
+                 (float)(int)y1);
+    }
   }
+}
+
+// Scales a list's segments about (VCNTRX, VCNTRY) into "ends",
+// as x0, y0, x1, y1 per segment
+void Viewer::scaleVectorList(const dodBYTE VLA[], std::vector<float> &ends) {
+  int numLists = VLA[0];
+  int ctr = 1;
 
-  while (curList < numLists) {
-    numVertices = VLA[ctr];
+  ends.clear();
+  for (int curList = 0; curList < numLists; ++curList) {
+    int numVertices = VLA[ctr];
     ++ctr;
-    curVertex = 0;
-    while (curVertex < (numVertices - 1)) {
-      float x0, y0, x1, y1;
-      x0 = ScaleXf((float)VLA[ctr]) + (float)VCNTRX;
-      y0 = ScaleYf((float)VLA[ctr + 1]) + (float)VCNTRY;
-      x1 = ScaleXf((float)VLA[ctr + 2]) + (float)VCNTRX;
-      y1 = ScaleYf((float)VLA[ctr + 3]) + (float)VCNTRY;
-
-      if (useVectorMode) {
-        // Batched drawing - accumulates lines for single draw call
-        addBatchedLine(x0, y0, x1, y1);
-      } else if (g_options & OPT_HIRES) {
-        // HIRES mode still uses immediate drawing
-        drawVector(x0, y0, x1, y1);
-      } else {
-        // Standard mode - truncate to integer coordinates
-        drawVector((float)(int)x0, (float)(int)y0, (float)(int)x1,
-                   (float)(int)y1);
-      }
+    for (int curVertex = 0; curVertex < numVertices - 1; ++curVertex) {
+      ends.push_back(ScaleXf((float)VLA[ctr]) + (float)VCNTRX);
+      ends.push_back(ScaleYf((float)VLA[ctr + 1]) + (float)VCNTRY);
+      ends.push_back(ScaleXf((float)VLA[ctr + 2]) + (float)VCNTRX);
+      ends.push_back(ScaleYf((float)VLA[ctr + 3]) + (float)VCNTRY);
       ctr += 2;
-      ++curVertex;
     }
-    ++curList;
     ctr += 2;
   }
+}
 
-  // Flush batched lines at end
-  if (useVectorMode) {
-    endLineBatch();
+// A list's segments at the current scale.  SETSCL() only picks
+// from the Scalef table, so at those scales each list is scaled
+// once and kept; any other scale (the fades) is done each time.
+const std::vector<float> &Viewer::scaledVectorList(const dodBYTE VLA[]) {
+  if (scaleIdx >= 0 && VXSCALf == Scalef[scaleIdx] &&
+      VYSCALf == Scalef[scaleIdx]) {
+    ScaledList &scaled = scaledLists[VLA];
+    if (!(scaled.built & (1 << scaleIdx))) {
+      scaleVectorList(VLA, scaled.ends[scaleIdx]);
+      scaled.built |= (1 << scaleIdx);
+    }
+    return scaled.ends[scaleIdx];
   }
+  scaleVectorList(VLA, scratchEnds);
+  return scratchEnds;
 }
 
 // Scales X-coordinate
@@ -2105,7 +2035,7 @@ float Viewer::ScaleYf(float y) { return ((y - VCNTRY) * VYSCALf) / 127.0f; }
 dodSHORT Viewer::ScaleY(int y) { return ((y - VCNTRY) * VYSCAL) / 127; }
 
 // Draws font vectors
-void Viewer::drawVectorListAQ(int VLA[]) {
+void Viewer::drawVectorListAQ(const dodBYTE VLA[]) {
   int numQuads = VLA[0];
   int curQuad = 0;
   int ctr = 1;
@@ -2126,64 +2056,78 @@ void Viewer::drawVectorListAQ(int VLA[]) {
   glEnd();
 }
 
-// Draws a character
-void Viewer::drawCharacter(char c) {
+// Index of the AZ_VLA entry for a character, 0 if it has none
+int Viewer::glyphIndex(char c) {
   if (c >= 'A' && c <= 'Z') {
-    drawVectorListAQ(AZ_VLA[c - 64]);
+    return c - 64;
   }
   if (c >= '0' && c <= '9') {
-    drawVectorListAQ(AZ_VLA[c - 13]); // Dependent on ASCII values
+    return c - 13; // Dependent on ASCII values
   }
   switch (c) {
   case ('<'):
-    drawVectorListAQ(AZ_VLA[31]);
-    break;
+    return 31;
   case ('>'):
-    drawVectorListAQ(AZ_VLA[32]);
-    break;
+    return 32;
   case ('{'):
-    drawVectorListAQ(AZ_VLA[33]);
-    break;
+    return 33;
   case ('}'):
-    drawVectorListAQ(AZ_VLA[34]);
-    break;
-  case (' '):
-    break;
+    return 34;
   case ('.'):
-    drawVectorListAQ(AZ_VLA[27]);
-    break;
+    return 27;
   case ('_'):
-    drawVectorListAQ(AZ_VLA[28]);
-    break;
+    return 28;
   case ('!'):
-    drawVectorListAQ(AZ_VLA[29]);
-    break;
+    return 29;
   case ('?'):
-    drawVectorListAQ(AZ_VLA[30]);
-    break;
+    return 30;
   case ('/'):
-    drawVectorListAQ(AZ_VLA[45]);
-    break;
+    return 45;
   case ('\\'):
-    drawVectorListAQ(AZ_VLA[46]);
-    break;
+    return 46;
   case ('%'):
-    drawVectorListAQ(AZ_VLA[47]);
-    break;
+    return 47;
   case ('+'):
-    drawVectorListAQ(AZ_VLA[48]);
-    break;
+    return 48;
   case ('-'):
-    drawVectorListAQ(AZ_VLA[49]);
-    break;
+    return 49;
   default:
-    break;
+    return 0;
+  }
+}
+
+// Draws a character
+void Viewer::drawCharacter(char c) {
+  int glyph = glyphIndex(c);
+  if (glyph != 0) {
+    drawVectorListAQ(AZ_VLA[glyph]);
   }
 }
 
-void Viewer::drawString_internal(int x, int y, dodBYTE *str, int len) {
+// Hands the font to the glyph batch
+void Viewer::storeGlyphs() {
+  for (int c = ' '; c < 128; ++c) {
+    int glyph = glyphIndex((char)c);
+    if (glyph != 0) {
+      glyphBatch.setGlyph((char)c, AZ_VLA[glyph]);
+    }
+  }
+}
+
+// Draws a string
+void Viewer::drawString_internal(int x, int y, dodBYTE *str, int len,
+                                 const GLfloat color[3]) {
   int ctr;
   char c;
+  if (glyphBatch.isInitialized()) {
+    std::string text;
+    for (ctr = 0; ctr < len; ++ctr) {
+      text += dod_to_ascii(*(str + ctr));
+    }
+    glyphBatch.add(x, y, text.c_str(), len);
+    glyphBatch.draw(color);
+    return;
+  }
   glLoadIdentity();
   glTranslatef(crd.newX(x * 8), crd.newY(((y + 1) * 8)), 0.0);
   for (ctr = 0; ctr < len; ++ctr) {
@@ -2231,25 +2175,7 @@ void Viewer::drawString(int x, int y, std::string str) {
 // Draws a line
 void Viewer::drawVector(float X0, float Y0, float X1, float Y1) {
   if (g_options & OPT_VECTOR) { // draw using GL vectors
-    GLfloat clrLine[3];
-
-    if (VCTFAD == 0xff)
-      return; // do not draw lines with VCTFAD=255
-
-    // calculate line color from VCTFAD
-    float flBirghtness = 1.0f / (VCTFAD / 2.0f + 1.0f);
-    // calculate color between FG and BG
-    clrLine[0] = fgColor[0] * flBirghtness + bgColor[0] * (1.0f - flBirghtness);
-    clrLine[1] = fgColor[1] * flBirghtness + bgColor[1] * (1.0f - flBirghtness);
-    clrLine[2] = fgColor[2] * flBirghtness + bgColor[2] * (1.0f - flBirghtness);
-
-    // draw the vector
-    glBegin(GL_LINES);
-    glColor3fv(clrLine);
-    glVertex2f(crd.newX(X0), crd.newY(Y0));
-    glVertex2f(crd.newX(X1), crd.newY(Y1));
-    glColor3fv(fgColor);
-    glEnd();
+    addBatchedLine(X0, Y0, X1, Y1);
   } else {
     float XL, YL, L;
     int FADCNT;
@@ -2275,13 +2201,21 @@ void Viewer::drawVector(float X0, float Y0, float X1, float Y1) {
       DY /= (double)scale;
       L *= scale;
     }
+    PixelBuffer &pixels = pixelBuf; // looked up once, not per pixel
+    bool buffered = pixels.isInitialized();
     XX = X0 + 0.5;
     YY = Y0 + 0.5;
     do {
       if (--FADCNT == 0) {
         FADCNT = VCTFAD + 1;
         if (XX >= 0.0 && XX < 256.0 && YY >= 0.0 && YY < 152.0) {
-          if (g_options & OPT_HIRES)
+          if (buffered) {
+            // Drawn as one texture when the frame is finished
+            if (g_options & OPT_HIRES)
+              pixels.plotHires(XX, YY);
+            else
+              pixels.plot((int)XX, (int)YY);
+          } else if (g_options & OPT_HIRES)
             plotPoint(XX, YY);
           else {
             plotPoint((int)XX, (int)YY);
@@ -2296,65 +2230,83 @@ void Viewer::drawVector(float X0, float Y0, float X1, float Y1) {
   }
 }
 
-// Begin batching line draws - accumulates lines until endLineBatch()
-void Viewer::beginLineBatch() {
-  lineBatch.clear();
-  batchingLines = true;
+// Queues a vector mode line.  Everything queued is drawn by
+// flushLines(), before anything that could overlap it.
+void Viewer::addBatchedLine(float X0, float Y0, float X1, float Y1) {
+  if (VCTFAD == 0xff)
+    return;  // Do not draw lines with VCTFAD=255
+
+  // Line color from VCTFAD
+  addBatchedLine(X0, Y0, X1, Y1, fadeColors[VCTFAD]);
 }
 
-// End batching and draw all accumulated lines at once
-void Viewer::endLineBatch() {
-  if (!batchingLines || lineBatch.empty()) {
-    batchingLines = false;
-    return;
-  }
+// Queues a line in the given color
+void Viewer::addBatchedLine(float X0, float Y0, float X1, float Y1,
+                            const GLfloat color[3]) {
+  LineVertex v0, v1;
+  for (int ctr = 0; ctr < 3; ++ctr) {
+    v0.color[ctr] = color[ctr];
+    v1.color[ctr] = color[ctr];
+  }
+  v0.x = crd.newX(X0);
+  v0.y = crd.newY(Y0);
+  v1.x = crd.newX(X1);
+  v1.y = crd.newY(Y1);
+  lineBatch.push_back(v0);
+  lineBatch.push_back(v1);
+}
 
-  // Draw all accumulated lines in a single glBegin/glEnd block
-  glBegin(GL_LINES);
-  for (const auto& line : lineBatch) {
-    glColor3fv(line.color);
-    glVertex2f(line.x0, line.y0);
-    glVertex2f(line.x1, line.y1);
-  }
-  glColor3fv(fgColor);  // Restore foreground color
-  glEnd();
+// Queues a filled rectangle with corners (X0,Y0) and (X1,Y1)
+void Viewer::addBatchedQuad(float X0, float Y0, float X1, float Y1,
+                            const GLfloat color[3]) {
+  LineVertex v;
+  for (int ctr = 0; ctr < 3; ++ctr) {
+    v.color[ctr] = color[ctr];
+  }
+  v.x = crd.newX(X0);
+  v.y = crd.newY(Y0);
+  quadBatch.push_back(v);
+  v.y = crd.newY(Y1);
+  quadBatch.push_back(v);
+  v.x = crd.newX(X1);
+  quadBatch.push_back(v);
+  v.y = crd.newY(Y0);
+  quadBatch.push_back(v);
+}
 
-  lineBatch.clear();
-  batchingLines = false;
+// Draws one queued stream from client-side arrays
+static void drawBatch(GLenum mode, const GLfloat *xy, const GLfloat *color,
+                      GLsizei stride, GLsizei count) {
+  glEnableClientState(GL_VERTEX_ARRAY);
+  glEnableClientState(GL_COLOR_ARRAY);
+  glVertexPointer(2, GL_FLOAT, stride, xy);
+  glColorPointer(3, GL_FLOAT, stride, color);
+  glDrawArrays(mode, 0, count);
+  glDisableClientState(GL_COLOR_ARRAY);
+  glDisableClientState(GL_VERTEX_ARRAY);
 }
 
-// Add a line to the batch (when batching) or draw immediately
-void Viewer::addBatchedLine(float X0, float Y0, float X1, float Y1) {
-  if (VCTFAD == 0xff)
-    return;  // Do not draw lines with VCTFAD=255
+// Draws everything queued: the resident vector lists, under one
+// program bind, then the quads, then the other lines.  The map is
+// one quad and one line batch.
+void Viewer::flushLines() {
+  vecStore.flush();
+  if (quadBatch.empty() && lineBatch.empty()) {
+    return;
+  }
 
-  // Calculate line color from VCTFAD
-  float flBrightness = 1.0f / (VCTFAD / 2.0f + 1.0f);
-  GLfloat clrLine[3];
-  clrLine[0] = fgColor[0] * flBrightness + bgColor[0] * (1.0f - flBrightness);
-  clrLine[1] = fgColor[1] * flBrightness + bgColor[1] * (1.0f - flBrightness);
-  clrLine[2] = fgColor[2] * flBrightness + bgColor[2] * (1.0f - flBrightness);
-
-  if (batchingLines) {
-    // Accumulate for batched drawing
-    BatchedLine bl;
-    bl.x0 = crd.newX(X0);
-    bl.y0 = crd.newY(Y0);
-    bl.x1 = crd.newX(X1);
-    bl.y1 = crd.newY(Y1);
-    bl.color[0] = clrLine[0];
-    bl.color[1] = clrLine[1];
-    bl.color[2] = clrLine[2];
-    lineBatch.push_back(bl);
-  } else {
-    // Draw immediately (fallback)
-    glBegin(GL_LINES);
-    glColor3fv(clrLine);
-    glVertex2f(crd.newX(X0), crd.newY(Y0));
-    glVertex2f(crd.newX(X1), crd.newY(Y1));
-    glColor3fv(fgColor);
-    glEnd();
+  glLoadIdentity();
+  if (!quadBatch.empty()) {
+    drawBatch(GL_QUADS, &quadBatch[0].x, quadBatch[0].color,
+              sizeof(LineVertex), (GLsizei)quadBatch.size());
+    quadBatch.clear();
+  }
+  if (!lineBatch.empty()) {
+    drawBatch(GL_LINES, &lineBatch[0].x, lineBatch[0].color,
+              sizeof(LineVertex), (GLsizei)lineBatch.size());
+    lineBatch.clear();
   }
+  glColor3fv(fgColor); // Restore foreground color
 }
 
 // Draws one pixel
@@ -24,9 +24,10 @@ is held by Douglas J. Morgan.
 
 #include "dod.h"
 #include "dodgame.h"
+#include <map>
 #include <vector>
 
-extern dodGame	game;
+extern DOD_CONTEXT_LOCAL dodGame	&game;
 
 class Viewer
 {
@@ -45,7 +46,7 @@ public:
 
 	bool		draw_fade();
 	void		enough_fade();
-	void		death_fade(int WIZ[]);
+	void		death_fade(const dodBYTE WIZ[]);
 	void		displayCopyright();
 	void		displayWelcomeMessage();
 	void		displayDeath();
@@ -64,7 +65,7 @@ public:
 	void		EXAMIN();
 	void		PCRLF();
 	void		PRTOBJ(int X, bool highlite);
-	void		OUTSTI(dodBYTE * comp);
+	void		OUTSTI(const dodBYTE * comp);
 	void		OUTSTR(dodBYTE * str);
 	void		OUTCHR(dodBYTE c);
 	char		dodToChar(dodBYTE c);
@@ -72,23 +73,29 @@ public:
 	void		TXTSCR();
 	void		VIEWER();
 	void		SETSCL();
-	void		DRAWIT(int * vl);
-	void		PDRAW(int * vl, dodBYTE dir, dodBYTE pdir);
-	void		CMRDRW(int * vl, int creNum);
+	void		DRAWIT(const dodBYTE * vl);
+	void		PDRAW(const dodBYTE * vl, dodBYTE dir, dodBYTE pdir);
+	void		CMRDRW(const dodBYTE * vl, int creNum);
 	void		SETFAD();
 	dodSHORT	ScaleX(int x);
 	dodSHORT	ScaleY(int y);
 	float		ScaleXf(float x);
 	float		ScaleYf(float y);
 	void		MAPPER();
+	void		MAPWAL();
 	void		setVidInv(bool inv);
-	void		drawVectorList(int VLA[]);
+	void		setVectorLists(const dodBYTE * const lists[]);
+	bool		loadVectorArt(const char * fn);
+	void		storeVectorLists();
+	void		storeGlyphs();
+	void		drawVectorList(const dodBYTE VLA[]);
 	void		drawVector(float X0, float Y0, float X1, float Y1);
 
-	// Batched line drawing for performance
-	void		beginLineBatch();
-	void		endLineBatch();
+	// Frame-wide line and quad streams
 	void		addBatchedLine(float X0, float Y0, float X1, float Y1);
+	void		addBatchedLine(float X0, float Y0, float X1, float Y1, const GLfloat color[3]);
+	void		addBatchedQuad(float X0, float Y0, float X1, float Y1, const GLfloat color[3]);
+	void		flushLines();
 	void		Reset();
 	bool		ShowFade(int fadeMode, bool inMainLoop = true);
 
@@ -116,6 +123,7 @@ public:
 	bool		done;
 	int			fadeVal;
 	dodBYTE		UPDATE;
+	bool		deferDraw;	// set during a scheduler pass: PUPDAT only marks UPDATE
 	dodSHORT	display_mode; // 0 = map, 1 = 3D, 2 = Examine, 3 = Prepare
 	int			fadChannel;
 
@@ -129,11 +137,11 @@ public:
 	Uint32		fadeStartTime;
 	Uint32		fadeNextFrameTime;
 
-	dodBYTE		Scale[21];
+	static const dodBYTE Scale[21];
 	float		Scalef[21];
-	int *		LArch[4];
-	int *		FArch[4];
-	int *		RArch[4];
+	const dodBYTE *	LArch[4];
+	const dodBYTE *	FArch[4];
+	const dodBYTE *	RArch[4];
 
 	char		textArea[(32*4)+1];
 	char		examArea[(32*19)+1];
@@ -158,22 +166,22 @@ public:
 	int			tcaret;
 	int			tlen;
 
-	dodBYTE		enough1[21];
-	dodBYTE		enough2[20];
-	dodBYTE		winner1[21];
-	dodBYTE		winner2[17];
-	dodBYTE		death[21];
-	dodBYTE		copyright[21];
-	dodBYTE		welcome1[14];
-	dodBYTE		welcome2[20];
-	dodBYTE		prepstr[6];
-	dodBYTE		exps[3];
-	dodBYTE		exam1[9];
-	dodBYTE		exam2[8];
-	dodBYTE		exam3[7];
+	static const dodBYTE enough1[21];
+	static const dodBYTE enough2[20];
+	static const dodBYTE winner1[21];
+	static const dodBYTE winner2[17];
+	static const dodBYTE death[21];
+	static const dodBYTE copyright[21];
+	static const dodBYTE welcome1[14];
+	static const dodBYTE welcome2[20];
+	static const dodBYTE prepstr[6];
+	static const dodBYTE exps[3];
+	static const dodBYTE exam1[9];
+	static const dodBYTE exam2[8];
+	static const dodBYTE exam3[7];
 	dodBYTE		NEWLUK;
 
-	int			LINES[11];
+	const dodBYTE *	LINES;
 
 	dodBYTE		HLFSTP;
 	dodBYTE		BAKSTP;
@@ -193,20 +201,65 @@ public:
 
 private:
 	// Internal Implementation
-	void drawVectorListAQ(int VLA[]);
+	void drawVectorListAQ(const dodBYTE VLA[]);
+	int glyphIndex(char c);
 	void drawCharacter(char c);
 	void drawString(int x, int y, std::string str);
-	void drawString_internal(int x, int y, dodBYTE * str, int len);
+	void drawString_internal(int x, int y, dodBYTE * str, int len,
+							  const GLfloat color[3]);
 	void plotPoint(double X, double Y);
 	char dod_to_ascii(dodBYTE c);
 
-	// Batched line drawing - reduces glBegin/glEnd overhead
-	struct BatchedLine {
-		GLfloat x0, y0, x1, y1;
+	// Segments of the lists drawn at each Scalef[] entry, see
+	// scaledVectorList()
+	struct ScaledList {
+		ScaledList() : built(0) {}
+		std::vector<float> ends[21];
+		unsigned int built; // bit per scale
+	};
+	void scaleVectorList(const dodBYTE VLA[], std::vector<float> &ends);
+	const std::vector<float> &scaledVectorList(const dodBYTE VLA[]);
+	std::map<const dodBYTE *, ScaledList> scaledLists;
+	std::vector<float> scratchEnds;
+	int scaleIdx; // Scalef[] entry set by SETSCL(), -1 before
+
+	// Line color for each VCTFAD, set by setVidInv()
+	GLfloat fadeColors[256][3];
+
+	// What VIEWER() drew, one entry per DRAWIT().  The whole
+	// list is the cache key for the 3D view, see drawView().
+	struct ViewCmd {
+		const dodBYTE *	vl;
+		float		scaleX;
+		float		scaleY;
+		int			scale;	// scaleIdx
+		dodBYTE		fade;	// VCTFAD
+		bool operator==(const ViewCmd &o) const {
+			return vl == o.vl && scaleX == o.scaleX && scaleY == o.scaleY &&
+				   scale == o.scale && fade == o.fade;
+		}
+	};
+	void drawView();
+	bool recordView;
+	std::vector<ViewCmd> viewCmds;
+	std::vector<ViewCmd> lastViewCmds;
+	int lastViewOptions;
+
+	// The loaded vector art file the lists point into, if any
+	std::vector<unsigned char> vectorArt;
+
+	// The maze the map cache was drawn for, see MAPPER()
+	dodBYTE mapMaze[1024];
+	bool mapMarkDoors;
+
+	// Lines and quads queued since the last flushLines(), as
+	// GL_LINES and GL_QUADS vertices in window coordinates
+	struct LineVertex {
+		GLfloat x, y;
 		GLfloat color[3];
 	};
-	std::vector<BatchedLine> lineBatch;
-	bool batchingLines;
+	std::vector<LineVertex> lineBatch;
+	std::vector<LineVertex> quadBatch;
 
 	// Data Fields
 	dodSHORT	VCNTRX;
@@ -219,104 +272,104 @@ private:
 	int			BAKSCL;
 	int			NORSCL;
 public:
-	int A_VLA[33];
-	int B_VLA[49];
-	int C_VLA[41];
-	int D_VLA[33];
-	int E_VLA[33];
-	int F_VLA[25];
-	int G_VLA[49];
-	int H_VLA[25];
-	int I_VLA[25];
-	int J_VLA[25];
-	int K_VLA[65];
-	int L_VLA[17];
-	int M_VLA[41];
-	int N_VLA[41];
-	int O_VLA[33];
-	int P_VLA[33];
-	int Q_VLA[57];
-	int R_VLA[57];
-	int S_VLA[57];
-	int T_VLA[33];
-	int U_VLA[25];
-	int V_VLA[41];
-	int W_VLA[41];
-	int X_VLA[73];
-	int Y_VLA[41];
-	int Z_VLA[57];
-	int NM0_VLA[33];
-	int NM1_VLA[25];
-	int NM2_VLA[49];
-	int NM3_VLA[57];
-	int NM4_VLA[33];
-	int NM5_VLA[49];
-	int NM6_VLA[41];
-	int NM7_VLA[49];
-	int NM8_VLA[57];
-	int NM9_VLA[49];
-	int PER_VLA[9];
-	int UND_VLA[9];
-	int EXP_VLA[17];
-	int QSM_VLA[49];
-	int SHL_VLA[9];
-	int SHR_VLA[33];
-	int LHL_VLA[17];
-	int LHR_VLA[41];
-	int FSL_VLA[41];	//Forward Slash
-	int BSL_VLA[41];	//Back Slash
-	int PCT_VLA[57];	//Percent
-	int PLS_VLA[17];	//Plus
-	int DSH_VLA[9];		//Dash
-	int * AZ_VLA[50];
-
-	int SP_VLA[39];
-	int WR_VLA[42];
-	int SC_VLA[41];
-	int BL_VLA[66];
-	int GL_VLA[141];
-	int VI_VLA[65];
-	int S1_VLA[130];
-	int S2_VLA[126];
-	int K1_VLA[153];
-	int K2_VLA[149];
-	int W0_VLA[133];
+	const dodBYTE * A_VLA;
+	const dodBYTE * B_VLA;
+	const dodBYTE * C_VLA;
+	const dodBYTE * D_VLA;
+	const dodBYTE * E_VLA;
+	const dodBYTE * F_VLA;
+	const dodBYTE * G_VLA;
+	const dodBYTE * H_VLA;
+	const dodBYTE * I_VLA;
+	const dodBYTE * J_VLA;
+	const dodBYTE * K_VLA;
+	const dodBYTE * L_VLA;
+	const dodBYTE * M_VLA;
+	const dodBYTE * N_VLA;
+	const dodBYTE * O_VLA;
+	const dodBYTE * P_VLA;
+	const dodBYTE * Q_VLA;
+	const dodBYTE * R_VLA;
+	const dodBYTE * S_VLA;
+	const dodBYTE * T_VLA;
+	const dodBYTE * U_VLA;
+	const dodBYTE * V_VLA;
+	const dodBYTE * W_VLA;
+	const dodBYTE * X_VLA;
+	const dodBYTE * Y_VLA;
+	const dodBYTE * Z_VLA;
+	const dodBYTE * NM0_VLA;
+	const dodBYTE * NM1_VLA;
+	const dodBYTE * NM2_VLA;
+	const dodBYTE * NM3_VLA;
+	const dodBYTE * NM4_VLA;
+	const dodBYTE * NM5_VLA;
+	const dodBYTE * NM6_VLA;
+	const dodBYTE * NM7_VLA;
+	const dodBYTE * NM8_VLA;
+	const dodBYTE * NM9_VLA;
+	const dodBYTE * PER_VLA;
+	const dodBYTE * UND_VLA;
+	const dodBYTE * EXP_VLA;
+	const dodBYTE * QSM_VLA;
+	const dodBYTE * SHL_VLA;
+	const dodBYTE * SHR_VLA;
+	const dodBYTE * LHL_VLA;
+	const dodBYTE * LHR_VLA;
+	const dodBYTE * FSL_VLA;	//Forward Slash
+	const dodBYTE * BSL_VLA;	//Back Slash
+	const dodBYTE * PCT_VLA;	//Percent
+	const dodBYTE * PLS_VLA;	//Plus
+	const dodBYTE * DSH_VLA;		//Dash
+	const dodBYTE * AZ_VLA[50];
+
+	const dodBYTE * SP_VLA;
+	const dodBYTE * WR_VLA;
+	const dodBYTE * SC_VLA;
+	const dodBYTE * BL_VLA;
+	const dodBYTE * GL_VLA;
+	const dodBYTE * VI_VLA;
+	const dodBYTE * S1_VLA;
+	const dodBYTE * S2_VLA;
+	const dodBYTE * K1_VLA;
+	const dodBYTE * K2_VLA;
+	const dodBYTE * W0_VLA;
 
 public:
-	int W1_VLA[199];
-	int W2_VLA[185];
+	const dodBYTE * W1_VLA;
+	const dodBYTE * W2_VLA;
 
 //private:
-	int LAD_VLA[56];
-	int HUP_VLA[29];
-	int HDN_VLA[19];
-	int CEI_VLA[6];
-	int LPK_VLA[12];
-	int RPK_VLA[12];
-	int FSD_VLA[8];
-	int LSD_VLA[8];
-	int RSD_VLA[8];
-	int RWAL_VLA[10];
-	int LWAL_VLA[10];
-	int FWAL_VLA[11];
-	int RPAS_VLA[15];
-	int LPAS_VLA[15];
-	int FPAS_VLA[1];
-	int RDOR_VLA[24];
-	int LDOR_VLA[24];
-	int FDOR_VLA[25];
+	const dodBYTE * LAD_VLA;
+	const dodBYTE * HUP_VLA;
+	const dodBYTE * HDN_VLA;
+	const dodBYTE * CEI_VLA;
+	const dodBYTE * LPK_VLA;
+	const dodBYTE * RPK_VLA;
+	const dodBYTE * FSD_VLA;
+	const dodBYTE * LSD_VLA;
+	const dodBYTE * RSD_VLA;
+	const dodBYTE * RWAL_VLA;
+	const dodBYTE * LWAL_VLA;
+	const dodBYTE * FWAL_VLA;
+	const dodBYTE * RPAS_VLA;
+	const dodBYTE * LPAS_VLA;
+	const dodBYTE * FPAS_VLA;
+	const dodBYTE * RDOR_VLA;
+	const dodBYTE * LDOR_VLA;
+	const dodBYTE * FDOR_VLA;
 
 	int FLATAB[3];
-	int ** FLATABv[3];
-	int * FWDOBJ[6];
-	int * FWDCRE[12];
-
-	int SHIE_VLA[14];
-	int SWOR_VLA[11];
-	int TORC_VLA[10];
-	int RING_VLA[12];
-	int SCRO_VLA[12];
-	int FLAS_VLA[10];
+	const dodBYTE ** FLATABv[3];
+	const dodBYTE * FWDOBJ[6];
+	const dodBYTE * FWDCRE[12];
+
+	const dodBYTE * SHIE_VLA;
+	const dodBYTE * SWOR_VLA;
+	const dodBYTE * TORC_VLA;
+	const dodBYTE * RING_VLA;
+	const dodBYTE * SCRO_VLA;
+	const dodBYTE * FLAS_VLA;
 };
 
 #endif // DOD_VIEWER_HEADER